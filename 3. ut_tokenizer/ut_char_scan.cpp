@@ -0,0 +1,146 @@
+/*! \file	ut_char_scan.cpp
+	\brief	Character run scanner unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Character run scanner unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/char_scan.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <random>
+#include <string>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_CHAR_SCAN
+	namespace {
+		using scanner_type = char const* (*)(char const*, char const*);
+
+		/*! Compares a scanner with its scalar reference for a run of 'fill' of every length up to 80,
+			ended by every byte value. */
+		bool matches_scalar(scanner_type scan, scanner_type scalar, char fill) {
+			bool ok = true;
+			for (std::size_t length = 0; length <= 80; ++length)
+				for (int c = 0; c < 256; ++c) {
+					std::string text(length, fill);
+					text += char(c);
+					text += std::string(40, fill);
+					auto const first = text.data(), last = first + text.size();
+					ok = ok && scan(first, last) == scalar(first, last);
+					ok = ok && scan(first, first + length) == first + length;		// run reaches the end
+				}
+			return ok;
+		}
+
+		/*! Generates a corpus of about 'size' bytes: one long expression of numbers, identifiers and operators. */
+		std::string make_corpus(std::size_t size) {
+			std::mt19937 random(20261017);
+			char const* operators[] = { " + ", " - ", " * ", " / ", " % ", " < ", " >= ", " == ", " ** ", "  ", "\t", " ", "\n" };
+			std::string corpus;
+			corpus.reserve(size + 64);
+			while (corpus.size() < size) {
+				switch (random() % 4) {
+				case 0: corpus += std::to_string(random()); break;
+				case 1: corpus += std::to_string(random() % 100000) + "." + std::to_string(random()); break;
+				case 2: corpus += "variable" + std::to_string(random() % 50); break;
+				default: corpus += std::string(1 + random() % 24, 'x') + std::to_string(random() % 10); break;
+				}
+				corpus += operators[random() % std::size(operators)];
+			}
+			return corpus + "1";
+		}
+
+		/*! Text used by the scanner benchmarks: an 8 MiB run of 'fill'. */
+		std::string const& run_text(char fill) {
+			static std::string texts[256];
+			auto& text = texts[static_cast<unsigned char>(fill)];
+			if (text.empty())
+				text.assign(8 << 20, fill);
+			return text;
+		}
+
+		/*! Scans the whole benchmark run of 'fill' with 'scan'. */
+		char const* scan_run(scanner_type scan, char fill) {
+			auto const& text = run_text(fill);
+			return scan(text.data(), text.data() + text.size());
+		}
+	}
+
+	GATS_TEST_CASE(char_scan_matches_scalar) {
+		GATS_CHECK(matches_scalar(space_run_end, space_run_end_scalar, ' '));
+		GATS_CHECK(matches_scalar(space_run_end, space_run_end_scalar, '\t'));
+		GATS_CHECK(matches_scalar(digit_run_end, digit_run_end_scalar, '7'));
+		GATS_CHECK(matches_scalar(alnum_run_end, alnum_run_end_scalar, 'q'));
+		GATS_CHECK(matches_scalar(alnum_run_end, alnum_run_end_scalar, 'Z'));
+		GATS_CHECK(matches_scalar(alnum_run_end, alnum_run_end_scalar, '0'));
+	}
+
+	GATS_TEST_CASE(char_scan_long_tokens) {
+		std::string const digits(1000, '9'), name = "a" + std::string(999, 'B');
+		Tokenizer tokenizer;
+		auto tokens = tokenizer.tokenize(std::string(300, ' ') + digits + "." + digits + " * " + name + std::string(300, '\t'));
+		GATS_CHECK(tokens.size() == 3);
+		GATS_CHECK(is<Real>(tokens[0]));
+		GATS_CHECK(is<Variable>(tokens[2]) && convert<Variable>(tokens[2])->name() == name);
+	}
+
+	GATS_TEST_CASE(char_scan_corpus) {
+		std::size_t const size = 256 * 1024;
+		struct { char fill; scanner_type scan; } const runs[] = {
+			{ ' ', space_run_end },
+			{ '5', digit_run_end },
+			{ 'k', alnum_run_end },
+		};
+		for (auto const& run : runs) {
+			std::string const text(size, run.fill);
+			GATS_CHECK(run.scan(text.data(), text.data() + size) == text.data() + size);
+		}
+
+		auto const corpus = make_corpus(size);
+		Tokenizer tokenizer;
+		GATS_CHECK(tokenizer.tokenize(corpus).size() > corpus.size() / 16);
+	}
+
+
+	GATS_BENCHMARK(bench_space_run, "char_scan") { gats::do_not_optimize(scan_run(space_run_end, ' ')); }
+	GATS_BENCHMARK(bench_space_run_scalar, "char_scan") { gats::do_not_optimize(scan_run(space_run_end_scalar, ' ')); }
+	GATS_BENCHMARK(bench_digit_run, "char_scan") { gats::do_not_optimize(scan_run(digit_run_end, '5')); }
+	GATS_BENCHMARK(bench_digit_run_scalar, "char_scan") { gats::do_not_optimize(scan_run(digit_run_end_scalar, '5')); }
+	GATS_BENCHMARK(bench_alnum_run, "char_scan") { gats::do_not_optimize(scan_run(alnum_run_end, 'k')); }
+	GATS_BENCHMARK(bench_alnum_run_scalar, "char_scan") { gats::do_not_optimize(scan_run(alnum_run_end_scalar, 'k')); }
+
+	GATS_BENCHMARK(bench_tokenize_corpus, "char_scan") {
+		static std::string const corpus = make_corpus(8 << 20);
+		static Tokenizer tokenizer;
+		gats::do_not_optimize(tokenizer.tokenize(corpus));
+	}
+#endif
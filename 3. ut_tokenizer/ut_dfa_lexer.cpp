@@ -0,0 +1,109 @@
+/*! \file	ut_dfa_lexer.cpp
+	\brief	Tokenizer DFA unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Tokenizer DFA unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/tokenizer.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <ee/variable.hpp>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_DFA_LEXER
+	namespace {
+		/*! Gets the token types of an expression, compared by typeid (not str()). */
+		std::vector<std::type_info const*> types_of(std::string const& expression) {
+			Tokenizer tokenizer;
+			std::vector<std::type_info const*> types;
+			for (auto const& token : tokenizer.tokenize(expression))
+				types.push_back(&typeid(*token));
+			return types;
+		}
+
+		template <typename... T>
+		std::vector<std::type_info const*> types() { return { &typeid(T)... }; }
+
+		/*! Gets the offset of the bad character tokenize() reports, or npos. */
+		std::size_t bad_character_at(std::string const& expression) {
+			try {
+				Tokenizer().tokenize(expression);
+			}
+			catch (Tokenizer::XBadCharacter const& e) {
+				return e.location();
+			}
+			return std::string::npos;
+		}
+	}
+
+	GATS_TEST_CASE(dfa_unary_binary_context) {
+		GATS_CHECK(types_of("-1") == (types<Negation, Integer>()));
+		GATS_CHECK(types_of("+1") == (types<Identity, Integer>()));
+		GATS_CHECK(types_of("2--1") == (types<Integer, Subtraction, Negation, Integer>()));
+		GATS_CHECK(types_of("(1)-1") == (types<LeftParenthesis, Integer, RightParenthesis, Subtraction, Integer>()));
+		GATS_CHECK(types_of("3!-1") == (types<Integer, Factorial, Subtraction, Integer>()));
+		GATS_CHECK(types_of("x+1") == (types<Variable, Addition, Integer>()));
+		GATS_CHECK(types_of("not -1") == (types<Not, Negation, Integer>()));
+		GATS_CHECK(types_of("max(1,-1)") == (types<Max, LeftParenthesis, Integer, ArgumentSeparator, Negation, Integer, RightParenthesis>()));
+		GATS_CHECK(types_of("1 ** -2") == (types<Integer, Power, Negation, Integer>()));
+	}
+
+	GATS_TEST_CASE(dfa_bang) {
+		GATS_CHECK(types_of("1 != 2") == (types<Integer, Inequality, Integer>()));
+		GATS_CHECK(types_of("1 ! = 2") == (types<Integer, Factorial, Assignment, Integer>()));
+		GATS_CHECK_THROW(Tokenizer().tokenize("!1"), Tokenizer::XTokenizer);
+		GATS_CHECK_THROW(Tokenizer().tokenize("1 + !2"), Tokenizer::XTokenizer);
+	}
+
+	GATS_TEST_CASE(dfa_character_classes) {
+		GATS_CHECK(types_of(" \t\n\v\f\r1\t") == (types<Integer>()));
+		GATS_CHECK(bad_character_at("1 + \xA0") == 4);
+		GATS_CHECK(bad_character_at("x\xE9") == 1);
+		GATS_CHECK(bad_character_at("1 _ 2") == 2);
+		GATS_CHECK(bad_character_at("1 + 2") == std::string::npos);
+	}
+
+	GATS_TEST_CASE(dfa_state_across_pieces) {
+		Tokenizer tokenizer;
+		Tokenizer::Cursor cursor("2", false);
+		GATS_CHECK(is<Integer>(tokenizer.next_token(cursor)));
+		GATS_CHECK(!tokenizer.next_token(cursor));
+		cursor.continue_with("-1");
+		GATS_CHECK(is<Subtraction>(tokenizer.next_token(cursor)));
+		GATS_CHECK(is<Integer>(tokenizer.next_token(cursor)));
+	}
+#endif
@@ -35,3 +35,6 @@
 #define TEST_PARSER true
 
 #define TEST_GREGORIAN true
+
+#define TEST_DFA_LEXER true
+#define TEST_CHAR_SCAN true
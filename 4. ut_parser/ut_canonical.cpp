@@ -0,0 +1,98 @@
+/*! \file	ut_canonical.cpp
+	\brief	Canonicalization and structural hash unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Canonical form unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/canonical.hpp>
+#include <ee/parser.hpp>
+#include <ee/real.hpp>
+#include <ee/tokenizer.hpp>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_CANONICAL
+	/*! Gets the structural hash of an expression using its own tokenizer. */
+	[[nodiscard]] Hash128 hash_of(Tokenizer::string_type const& expression) {
+		Tokenizer tokenizer;
+		return structural_hash(Parser().parse(tokenizer.tokenize(expression)));
+	}
+
+	GATS_TEST_CASE(canonical_whitespace_and_case) {
+		GATS_CHECK(hash_of("sin(x)+1") == hash_of("  SIN( x ) + 1 "));
+		GATS_CHECK(hash_of("a and b") == hash_of("a AND b"));
+	}
+
+	GATS_TEST_CASE(canonical_redundant_parenthesis) {
+		GATS_CHECK(hash_of("((a))*(2)") == hash_of("a*2"));
+		GATS_CHECK(hash_of("(a+b)+c") == hash_of("a+b+c"));
+	}
+
+	GATS_TEST_CASE(canonical_commutative_operands) {
+		GATS_CHECK(hash_of("a+b") == hash_of("b+a"));
+		GATS_CHECK(hash_of("x*y*2") == hash_of("2*(y*x)"));
+		GATS_CHECK(hash_of("a==1") == hash_of("1==a"));
+		GATS_CHECK(hash_of("max(a,3)") == hash_of("max(3,a)"));
+		GATS_CHECK(hash_of("p or q and r") == hash_of("r and q or p"));
+	}
+
+	GATS_TEST_CASE(canonical_distinct_expressions) {
+		GATS_CHECK(hash_of("a-b") != hash_of("b-a"));
+		GATS_CHECK(hash_of("a**b") != hash_of("b**a"));
+		GATS_CHECK(hash_of("1+2") != hash_of("1+3"));
+		GATS_CHECK(hash_of("a") != hash_of("b"));
+		GATS_CHECK(hash_of("1") != hash_of("1.0"));
+	}
+
+	GATS_TEST_CASE(canonical_form_is_stable) {
+		Tokenizer tokenizer;
+		auto form1 = canonicalize(Parser().parse(tokenizer.tokenize("b + a")));
+		auto form2 = canonicalize(Parser().parse(tokenizer.tokenize("a + b")));
+		GATS_CHECK(form1.rpn == form2.rpn);
+		GATS_CHECK(form1.hash == canonicalize(form1.rpn).hash);
+		GATS_CHECK(form1.hash.str().size() == 32);
+	}
+
+	GATS_TEST_CASE(canonical_side_effects_keep_order) {
+		Tokenizer tokenizer;
+		auto form = canonicalize(Parser().parse(tokenizer.tokenize("x + (x = 2)")));
+		GATS_CHECK(form.rpn.size() == 5);
+		GATS_CHECK(form.rpn[0] == tokenizer.get_variable("x"));
+	}
+
+	GATS_TEST_CASE(canonical_tiny_reals) {
+		// both print as zero to Real::str()'s 1000 decimals
+		TokenList const one{ make<Real>(Real::value_type("1e-1200")) };
+		TokenList const three{ make<Real>(Real::value_type("3e-1200")) };
+		GATS_CHECK(one[0]->str() == three[0]->str());
+		GATS_CHECK(structural_hash(one) != structural_hash(three));
+		GATS_CHECK(exact_str(*one[0]) != exact_str(*three[0]));
+	}
+#endif // TEST_CANONICAL
@@ -0,0 +1,179 @@
+/*! \file	ut_incremental_parser.cpp
+	\brief	Incremental parser unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Incremental parser unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/incremental_parser.hpp>
+#include <ee/integer.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <typeinfo>
+
+#include "ut_postfix_compare.hpp"
+#include "ut_test_phases.hpp"
+
+
+#if TEST_INCREMENTAL_PARSER
+	/*! Tests if an incrementally maintained parser matches one built from its text in one go. */
+	[[nodiscard]] static bool matches_from_scratch(IncrementalParser const& incremental, Tokenizer& tokenizer) {
+		IncrementalParser scratch(tokenizer);
+		(void)scratch.assign(incremental.text());
+
+		bool const sameLexemes = std::equal(incremental.lexemes().begin(), incremental.lexemes().end(),
+			scratch.lexemes().begin(), scratch.lexemes().end(), [](auto const& l, auto const& r) {
+				return l.offset == r.offset && l.length == r.length && l.state == r.state && typeid(*l.token) == typeid(*r.token);
+			});
+		return sameLexemes
+			&& incremental.error().code == scratch.error().code
+			&& incremental.error().offset == scratch.error().offset
+			&& (incremental.error() || is_same_postfix(incremental.postfix(), scratch.postfix()));
+	}
+
+	GATS_TEST_CASE(incremental_matches_parse) {
+		Tokenizer tokenizer;
+		IncrementalParser incremental(tokenizer);
+		std::string const expr = "max(12, -x) ** 2 + sin(3.5) * (y - 4)! >= 0b101";
+		auto update = incremental.assign(expr);
+		GATS_CHECK(!update.error);
+		GATS_CHECK(update.inserted == incremental.lexemes().size());
+		GATS_CHECK(is_same_postfix(incremental.postfix(), Parser().parse(tokenizer.tokenize(expr))));
+	}
+
+	GATS_TEST_CASE(incremental_typing) {
+		Tokenizer tokenizer;
+		IncrementalParser incremental(tokenizer);
+		std::string const expr = "(12 + x) * 3 - max(4, 5) ** 2 != 7!";
+		bool ok = true;
+		for (std::size_t i = 0; i < expr.size(); ++i) {
+			(void)incremental.edit(i, 0, expr.substr(i, 1));
+			ok = ok && matches_from_scratch(incremental, tokenizer);
+		}
+		GATS_CHECK(ok);
+		GATS_CHECK(incremental.text() == expr);
+		GATS_CHECK(!incremental.error());
+		GATS_CHECK(is_same_postfix(incremental.postfix(), Parser().parse(tokenizer.tokenize(expr))));
+	}
+
+	GATS_TEST_CASE(incremental_changed_tokens) {
+		Tokenizer tokenizer;
+		IncrementalParser incremental(tokenizer);
+		(void)incremental.assign("1 + 2 + 3");
+
+		auto update = incremental.edit(4, 1, "25");		// 1 + 25 + 3
+		GATS_CHECK(update.first == 2);
+		GATS_CHECK(update.removed == 1);
+		GATS_CHECK(update.inserted == 1);
+		GATS_CHECK(incremental.lexemes()[4].offset == 9);
+		GATS_CHECK(value_of<Integer>(RPNEvaluator().evaluate(incremental.postfix())) == 29);
+
+		update = incremental.edit(2, 1, "-");			// 1 - 25 + 3
+		GATS_CHECK(update.first == 1);
+		GATS_CHECK(update.removed == 1);
+		GATS_CHECK(update.inserted == 1);
+
+		update = incremental.edit(1, 0, "2");			// 12 - 25 + 3
+		GATS_CHECK(update.first == 0);
+		GATS_CHECK(update.removed == 1);
+		GATS_CHECK(update.inserted == 1);
+		GATS_CHECK(value_of<Integer>(RPNEvaluator().evaluate(incremental.postfix())) == -10);
+
+		update = incremental.edit(3, 1, "");			// 12  25 + 3: '25' now follows an operand
+		GATS_CHECK(update.first == 1);
+		GATS_CHECK(update.removed == 2);
+		GATS_CHECK(update.inserted == 1);
+	}
+
+	GATS_TEST_CASE(incremental_reparse_from_sync_point) {
+		Tokenizer tokenizer;
+		IncrementalParser incremental(tokenizer);
+		std::string expr = "1";
+		for (int i = 0; i < 50; ++i)
+			expr += " + 1";
+		(void)incremental.assign(expr);
+
+		auto update = incremental.edit(expr.size() - 1, 1, "7");
+		GATS_CHECK(update.first == incremental.lexemes().size() - 1);
+		GATS_CHECK(update.reparsedFrom + IncrementalParser::sync_interval_c > update.first);
+		GATS_CHECK(update.reparsedFrom <= update.first);
+		GATS_CHECK(value_of<Integer>(RPNEvaluator().evaluate(incremental.postfix())) == 57);
+		GATS_CHECK(matches_from_scratch(incremental, tokenizer));
+	}
+
+	GATS_TEST_CASE(incremental_errors) {
+		Tokenizer tokenizer;
+		IncrementalParser incremental(tokenizer);
+		auto update = incremental.assign("(1 + 2");
+		GATS_CHECK(update.error.code == ErrorCode::MissingRightParenthesis);
+		GATS_CHECK(update.error.offset == 6);
+
+		update = incremental.edit(6, 0, ")");
+		GATS_CHECK(!update.error);
+
+		update = incremental.edit(3, 1, "$");
+		GATS_CHECK(update.error.code == ErrorCode::BadCharacter);
+		GATS_CHECK(update.error.offset == 3);
+
+		update = incremental.edit(3, 1, "+");
+		GATS_CHECK(!update.error);
+		GATS_CHECK(matches_from_scratch(incremental, tokenizer));
+
+		update = incremental.edit(0, 3, "sin ");		// sin  + 2): no '('
+		GATS_CHECK(update.error.code == ErrorCode::FunctionWithoutParenthesis);
+
+		GATS_CHECK_THROW(incremental.edit(100, 0, "1"), std::out_of_range);
+	}
+
+	GATS_TEST_CASE(incremental_random_edits) {
+		char const* fragments[] = { "1", "23", "4.5", "0b1", "x", "yy", " ", "  ", "+", "-", "*", "**", "/", "(", ")",
+			"!", "=", "==", "<", "<=", ",", "max(", "sin", "not ", ".", "$" };
+		std::mt19937 random(20261017);
+		Tokenizer tokenizer;
+		IncrementalParser incremental(tokenizer);
+		(void)incremental.assign("1 + 2");
+
+		bool ok = true;
+		for (int i = 0; i < 3000 && ok; ++i) {
+			auto const size = incremental.text().size();
+			auto const offset = size ? random() % (size + 1) : 0;
+			auto const removed = std::min<std::size_t>(random() % 4, size - offset);
+			auto const inserted = random() % 3 ? fragments[random() % std::size(fragments)] : "";
+			(void)incremental.edit(offset, removed, inserted);
+			ok = matches_from_scratch(incremental, tokenizer);
+			if (incremental.text().size() > 60)
+				(void)incremental.edit(0, incremental.text().size() - 20, "");
+		}
+		GATS_CHECK(ok);
+	}
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+/*! \file	ut_postfix_compare.hpp
+	\brief	Postfix expression comparison shared by the parser unit tests.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <ee/operand.hpp>
+#include <ee/token.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <typeinfo>
+
+
+/*! How is_same_postfix() matches variables. */
+enum class VariableMatch {
+	Identity,	/// the same Variable object (one Tokenizer).
+	Name,		/// the same name (separate symbol tables).
+};
+
+
+/*! Compares postfix expressions token by token (kind, and value of literals). */
+[[nodiscard]] inline bool is_same_postfix(TokenList const& lhs, TokenList const& rhs, VariableMatch variables = VariableMatch::Identity) {
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [variables](Token::pointer_type const& l, Token::pointer_type const& r) {
+		if (typeid(*l) != typeid(*r))
+			return false;
+		if (is<Variable>(l))
+			return variables == VariableMatch::Identity ? l.get() == r.get() : convert<Variable>(l)->name() == convert<Variable>(r)->name();
+		return !is<Operand>(l) || l->str() == r->str();
+	});
+}
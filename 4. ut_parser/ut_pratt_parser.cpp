@@ -0,0 +1,119 @@
+/*! \file	ut_pratt_parser.cpp
+	\brief	Pratt parser and AST unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Pratt parser unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/ast.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/parser.hpp>
+#include <ee/pratt_parser.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+
+#include "ut_postfix_compare.hpp"
+#include "ut_test_phases.hpp"
+
+
+#if TEST_PRATT_PARSER
+	/*! Tests that the AST's postfix form equals Parser's, token for token. */
+	[[nodiscard]] bool pratt_matches_parser(Tokenizer::string_type const& expression) {
+		Tokenizer tokenizer;
+		auto expected = Parser().parse(tokenizer.tokenize(expression));
+		auto actual = PrattParser(tokenizer).parse(expression).to_rpn();
+		return is_same_postfix(expected, actual);
+	}
+
+	GATS_TEST_CASE(pratt_same_rpn_as_parser) {
+		char const* expressions[] = {
+			"1 + 2 * 3", "(1 + 2) * 3", "1 - 2 - 3", "2 ** 3 ** 2", "-2 ** 2", "-3!", "2 + 3! * 4",
+			"not true and false or true xor false", "1 < 2 == 3 >= 4", "x = y = 5 + 1",
+			"max(1, min(2, 3)) + arctan2(1.0, 2)", "sin(pi / 2) * -cos(0)", "((((7))))", "5 mod 3 % 2",
+			"a nand b nor c xnor d",
+		};
+		for (auto expr : expressions)
+			GATS_CHECK(pratt_matches_parser(expr));
+	}
+
+	GATS_TEST_CASE(pratt_tree_shape) {
+		Tokenizer tokenizer;
+		Ast ast = PrattParser(tokenizer).parse("max(a, 2) + -b!");
+		GATS_CHECK(ast.size() == 7);
+
+		auto const& root = ast[ast.root()];
+		GATS_CHECK(root.kind == Ast::Kind::Binary);
+		GATS_CHECK(is<Addition>(root.token));
+		GATS_CHECK(root.span.offset == 0 && root.span.length == 15);
+
+		auto children = ast.children(ast.root());
+		GATS_CHECK(children.size() == 2);
+		auto const& call = ast[children[0]];
+		GATS_CHECK(call.kind == Ast::Kind::Call);
+		GATS_CHECK(call.span.offset == 0 && call.span.length == 9);
+		GATS_CHECK(ast[ast.children(children[0])[0]].kind == Ast::Kind::Variable);
+		GATS_CHECK(ast[ast.children(children[0])[1]].kind == Ast::Kind::Literal);
+
+		// prefix operators bind looser than postfix: -(b!)
+		auto const& negation = ast[children[1]];
+		GATS_CHECK(negation.kind == Ast::Kind::Prefix);
+		GATS_CHECK(negation.span.offset == 12 && negation.span.length == 3);
+		GATS_CHECK(ast[ast.children(children[1])[0]].kind == Ast::Kind::Postfix);
+	}
+
+	GATS_TEST_CASE(pratt_parenthesized_span) {
+		Tokenizer tokenizer;
+		Ast ast = PrattParser(tokenizer).parse(" (1 + 2) * 3");
+		auto const& root = ast[ast.root()];
+		GATS_CHECK(root.span.offset == 1 && root.span.end() == 12);
+		GATS_CHECK(ast[ast.children(ast.root())[0]].span.offset == 2);
+		GATS_CHECK(PrattParser(tokenizer).parse("   ").empty());
+	}
+
+	/*! Gets the error offset reported for an invalid expression, or npos if it parses. */
+	[[nodiscard]] std::size_t pratt_error_location(Tokenizer::string_type const& expression) {
+		Tokenizer tokenizer;
+		try {
+			(void)PrattParser(tokenizer).parse(expression);
+		}
+		catch (PrattParser::XParser const& ex) {
+			return ex.location();
+		}
+		return Tokenizer::string_type::npos;
+	}
+
+	GATS_TEST_CASE(pratt_errors) {
+		GATS_CHECK(pratt_error_location("(1 + 2") == 6);
+		GATS_CHECK(pratt_error_location("1 + 2)") == 5);
+		GATS_CHECK(pratt_error_location("1 + * 2") == 4);
+		GATS_CHECK(pratt_error_location("1 2") == 2);
+		GATS_CHECK(pratt_error_location("max(1)") == 0);
+		GATS_CHECK(pratt_error_location("1 + 2") == Tokenizer::string_type::npos);
+	}
+#endif // TEST_PRATT_PARSER
@@ -0,0 +1,201 @@
+/*! \file	ut_rule_set.cpp
+	\brief	Parallel rule file compilation unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Parallel rule file compilation and symbol table unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/operand.hpp>
+#include <ee/parser.hpp>
+#include <ee/rule_set.hpp>
+#include <ee/symbol_table.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ut_postfix_compare.hpp"
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_RULE_SET
+	namespace {
+		/*! Makes a rule file: mostly valid rules over 100 variables, with blank lines, CRLF line ends and errors. */
+		std::string make_rules(std::size_t count) {
+			char const* const forms[] = { "v%zu = v%zu + %zu * 2", "max(v%zu, v%zu) - %zu!", "(v%zu + v%zu) ** %zu", "v%zu * v%zu / %zu.5" };
+			std::string text;
+			char line[128];
+			for (std::size_t i = 0; i < count; ++i) {
+				if (i % 97 == 0)
+					text += "   \n";
+				else if (i % 89 == 0)
+					text += "1 + (2 * v" + std::to_string(i % 100) + "\n";
+				else if (i % 83 == 0)
+					text += "1 $ 2\r\n";
+				else {
+					std::snprintf(line, sizeof(line), forms[i % 4], i % 100, (i * 7) % 100, i % 5);
+					text += line;
+					text += i % 2 ? "\n" : "\r\n";
+				}
+			}
+			return text;
+		}
+
+		bool is_same_rules(RuleSet const& lhs, RuleSet const& rhs) {
+			if (lhs.rules().size() != rhs.rules().size())
+				return false;
+			for (std::size_t i = 0; i < lhs.rules().size(); ++i) {
+				auto const& l = lhs.rules()[i];
+				auto const& r = rhs.rules()[i];
+				if (l.line() != r.line() || l.error().code != r.error().code || l.error().offset != r.error().offset || !is_same_postfix(l.postfix(), r.postfix(), VariableMatch::Name))
+					return false;
+			}
+			return true;
+		}
+	}
+
+	GATS_TEST_CASE(symbol_table_intern) {
+		SymbolTable symbols;
+		GATS_CHECK(symbols.find("x") == nullptr);
+		auto x = symbols.intern("x");
+		GATS_CHECK(is<Variable>(x));
+		GATS_CHECK(symbols.intern("x").get() == x.get());
+		GATS_CHECK(symbols.find("x").get() == x.get());
+		GATS_CHECK(symbols.intern("X").get() != x.get());
+		GATS_CHECK(symbols.size() == 2);
+
+		// (Token == compares values, so identity is compared with get())
+		// tokenizers sharing the table share the variables
+		Tokenizer first(symbols), second(symbols);
+		GATS_CHECK(first.tokenize("x + y")[2].get() == second.tokenize("y * 2")[0].get());
+		GATS_CHECK(first.tokenize("x")[0].get() == x.get());
+		GATS_CHECK(symbols.size() == 3);
+	}
+
+	GATS_TEST_CASE(symbol_table_concurrent_intern) {
+		SymbolTable symbols;
+		constexpr std::size_t nameCount = 2000, threadCount = 8;
+		std::vector<std::vector<Token::pointer_type>> seen(threadCount, std::vector<Token::pointer_type>(nameCount));
+		std::vector<std::thread> threads;
+		for (std::size_t t = 0; t < threadCount; ++t)
+			threads.emplace_back([&, t] {
+				for (std::size_t i = 0; i < nameCount; ++i) {
+					std::size_t const name = (i + t * nameCount / threadCount) % nameCount;	// each thread starts elsewhere
+					seen[t][name] = symbols.intern("v" + std::to_string(name));
+				}
+			});
+		for (auto& t : threads)
+			t.join();
+
+		bool allSame = true;
+		for (std::size_t i = 0; i < nameCount; ++i)
+			for (std::size_t t = 0; t < threadCount; ++t)
+				allSame = allSame && seen[t][i] && seen[t][i].get() == symbols.find("v" + std::to_string(i)).get();
+		GATS_CHECK(allSame);
+		GATS_CHECK(symbols.size() == nameCount);
+	}
+
+	GATS_TEST_CASE(rule_set_compile) {
+		auto rules = RuleSet::compile("x = 1 + 2\n\n  \r\ny * (x - 3)\r\n1 $ 2\n(1 + 2\nz", 1);
+		GATS_CHECK(rules.statistics().lines == 7);
+		GATS_CHECK(rules.statistics().rules == 5);
+		GATS_CHECK(rules.statistics().errors == 2);
+		GATS_CHECK(rules.rules().size() == 5);
+		GATS_CHECK(rules.rules()[0].line() == 0 && rules.rules()[0].postfix().size() == 5 && !rules.rules()[0].error());
+		GATS_CHECK(rules.rules()[1].line() == 3 && rules.rules()[1].postfix().size() == 5);
+		GATS_CHECK(rules.rules()[2].line() == 4 && rules.rules()[2].error().code == ErrorCode::BadCharacter && rules.rules()[2].error().offset == 2);
+		GATS_CHECK(rules.rules()[3].line() == 5 && rules.rules()[3].error().code == ErrorCode::MissingRightParenthesis && rules.rules()[3].postfix().empty());
+		GATS_CHECK(rules.rules()[4].line() == 6 && rules.rules()[4].postfix().size() == 1);
+		GATS_CHECK(rules.rules()[0].postfix()[0].get() == rules.rules()[1].postfix()[1].get());
+		GATS_CHECK(rules.symbols()->size() == 3);
+		GATS_CHECK(RuleSet::compile("", 4).rules().empty());
+	}
+
+	GATS_TEST_CASE(rule_set_parallel_matches_sequential) {
+		auto const text = make_rules(20000);
+		auto const sequential = RuleSet::compile(text, 1);
+		GATS_CHECK(sequential.statistics().threads == 1);
+		GATS_CHECK(sequential.statistics().errors > 0);
+
+		// compare the single thread compile with the plain Tokenizer and Parser
+		Tokenizer tokenizer;
+		Parser parser;
+		bool matches = true;
+		for (auto const& rule : sequential.rules()) {
+			if (rule.error())
+				continue;
+			std::size_t first = 0;
+			for (std::size_t line = 0; line < rule.line(); ++line)
+				first = text.find('\n', first) + 1;
+			auto source = text.substr(first, text.find_first_of("\r\n", first) - first);
+			matches = matches && is_same_postfix(parser.parse(tokenizer.tokenize(source)), rule.postfix(), VariableMatch::Name);
+		}
+		GATS_CHECK(matches);
+
+		for (unsigned threads : { 2u, 7u, 16u }) {
+			auto const parallel = RuleSet::compile(text, threads);
+			GATS_CHECK(parallel.statistics().threads == threads);
+			GATS_CHECK(parallel.statistics().lines == sequential.statistics().lines);
+			GATS_CHECK(is_same_rules(parallel, sequential));
+
+			// one Variable token per name, whichever thread compiled the rule
+			bool shared = true;
+			for (auto const& rule : parallel.rules())
+				for (auto const& token : rule.postfix())
+					if (is<Variable>(token))
+						shared = shared && parallel.symbols()->find(convert<Variable>(token)->name()).get() == token.get();
+			GATS_CHECK(shared);
+			GATS_CHECK(parallel.symbols()->size() == 100);
+		}
+	}
+
+	GATS_TEST_CASE(rule_set_load) {
+		auto const path = std::string("ut_rule_set.rules.txt");
+		{
+			std::ofstream out(path, std::ios::binary);
+			out << make_rules(5000);
+		}
+		auto const reference = RuleSet::load(path, 1);
+		GATS_CHECK(reference.statistics().lines == 5000);
+
+		for (unsigned threads : { 4u, 16u }) {
+			auto const rules = RuleSet::load(path, threads);
+			GATS_CHECK(rules.statistics().threads == threads);
+			GATS_CHECK(is_same_rules(rules, reference));
+		}
+		std::remove(path.c_str());
+
+		GATS_CHECK_THROW((void)RuleSet::load("no such rule file.txt"), std::system_error);
+	}
+#endif // TEST_RULE_SET
@@ -0,0 +1,125 @@
+/*! \file	ut_stream_parser.cpp
+	\brief	Streaming parser unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Streaming parser unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/integer.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/stream_parser.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+#include <sstream>
+#include <string>
+
+#include "ut_postfix_compare.hpp"
+#include "ut_test_phases.hpp"
+
+
+#if TEST_STREAM_PARSER
+	/*! Collects the streamed postfix tokens. */
+	class StreamedTokens : public TokenSink {
+	public:
+		TokenList tokens;
+		void push(Token::pointer_type const& token) override { tokens.push_back(token); }
+	};
+
+	/*! Makes a long expression exercising every kind of token boundary. */
+	[[nodiscard]] std::string make_stream_expression(int terms) {
+		std::string expr = "0";
+		for (int i = 0; i < terms; ++i)
+			expr += " + max(" + std::to_string(i) + ", -2) ** 2 ** 1 - (3! * 0b101 >= 2.5) * 0 + 12345678901234567890 % 7";
+		return expr;
+	}
+
+	GATS_TEST_CASE(stream_same_rpn_as_parser) {
+		auto const expr = make_stream_expression(50);
+		Tokenizer tokenizer;
+		auto expected = Parser().parse(tokenizer.tokenize(expr));
+
+		// small chunks force cuts between all kinds of tokens
+		for (std::size_t chunk : { 1, 7, 64, 4096 }) {
+			StreamedTokens fromStream, fromBuffer;
+			std::istringstream in(expr);
+			StreamParser parser(tokenizer, chunk);
+			parser.parse(in, fromStream);
+			GATS_CHECK(is_same_postfix(fromStream.tokens, expected));
+
+			parser.parse(std::string_view(expr), fromBuffer);
+			GATS_CHECK(is_same_postfix(fromBuffer.tokens, expected));
+		}
+	}
+
+	GATS_TEST_CASE(stream_bounded_buffer) {
+		std::string expr = "1";
+		for (int i = 0; i < 100000; ++i)
+			expr += " + 1";
+
+		Tokenizer tokenizer;
+		RPNEvaluator rpn;
+		std::istringstream in(expr);
+		StreamParser parser(tokenizer, 1024);
+		parser.parse(in, rpn);
+		GATS_CHECK(value_of<Integer>(rpn.finish()) == 100001);
+		GATS_CHECK(parser.peak_buffer() < 2 * 1024);
+	}
+
+	GATS_TEST_CASE(stream_error_offsets) {
+		std::string const expr = make_stream_expression(20) + " + $";
+		Tokenizer tokenizer;
+		StreamedTokens sink;
+		try {
+			std::istringstream in(expr);
+			StreamParser(tokenizer, 100).parse(in, sink);
+			GATS_FAIL("bad character not detected");
+		}
+		catch (Tokenizer::XBadCharacter const& ex) {
+			GATS_CHECK(ex.location() == expr.size() - 1);
+			GATS_CHECK(ex.expression().empty());
+		}
+
+		try {
+			std::istringstream in("(1 + 2) * (3 + 4");
+			StreamParser(tokenizer, 4).parse(in, sink);
+			GATS_FAIL("missing parenthesis not detected");
+		}
+		catch (Parser::XParser const& ex) {
+			GATS_CHECK(ex.location() == 16);
+		}
+
+		try {
+			StreamParser(tokenizer).parse(std::string_view("1 + 2) * 3"), sink);
+			GATS_FAIL("unmatched parenthesis not detected");
+		}
+		catch (Parser::XParser const& ex) {
+			GATS_CHECK(ex.location() == 5);
+		}
+	}
+#endif // TEST_STREAM_PARSER
@@ -34,4 +34,10 @@
 
 #define TEST_PARSER true
 
+#define TEST_CANONICAL true
+#define TEST_PRATT_PARSER true
+#define TEST_STREAM_PARSER true
+#define TEST_INCREMENTAL_PARSER true
+#define TEST_RULE_SET true
+
 #define TEST_GREGORIAN true
@@ -0,0 +1,90 @@
+/*! \file	ut_admission.cpp
+	\brief	Admission control unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Server admission control unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/admission.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_ADMISSION
+	using namespace std::chrono_literals;
+
+	namespace {
+		/*! Tests if the predicted wait is 'seconds', to rounding. */
+		bool waits(AdmissionLoad const& load, double seconds) {
+			return std::abs(predicted_wait(load).count() - seconds) < 1e-9 * std::max(seconds, 1.0);
+		}
+	}
+
+	GATS_TEST_CASE(admission_shared_wait) {
+		AdmissionLoad load;
+		load.waiting = 400;
+		load.backlog = 10;
+		load.lineSeconds = 0.001;
+		load.workers = 8;
+		GATS_CHECK(waits(load, 0.05));
+		GATS_CHECK(admit(load, 1000, 100ms) == Admission::Admitted);
+		GATS_CHECK(admit(load, 1000, 20ms) == Admission::DeadlineMissed);
+	}
+
+	GATS_TEST_CASE(admission_session_backlog) {
+		// one client's burst runs on one worker: it isn't shared by the other seven
+		AdmissionLoad load;
+		load.waiting = 100;
+		load.classWaiting = 100;
+		load.backlog = 100;
+		load.lineSeconds = 0.001;
+		load.workers = 8;
+		GATS_CHECK(waits(load, 0.1));
+		GATS_CHECK(admit(load, 1000, 50ms) == Admission::DeadlineMissed);
+		GATS_CHECK(admit(load, 1000, 200ms) == Admission::Admitted);
+	}
+
+	GATS_TEST_CASE(admission_queue_full) {
+		AdmissionLoad load;
+		load.classWaiting = 10;
+		GATS_CHECK(admit(load, 10, 0ms) == Admission::QueueFull);
+		GATS_CHECK(admit(load, 11, 0ms) == Admission::Admitted);
+	}
+
+	GATS_TEST_CASE(admission_no_deadline) {
+		AdmissionLoad load;
+		load.waiting = load.backlog = 1'000'000;
+		load.lineSeconds = 1.0;
+		load.workers = 0;		// not started yet
+		GATS_CHECK(admit(load, 10, 0ms) == Admission::Admitted);
+		GATS_CHECK(waits(load, 1'000'000.0));
+	}
+#endif // TEST_ADMISSION
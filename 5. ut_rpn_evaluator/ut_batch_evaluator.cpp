@@ -0,0 +1,191 @@
+/*! \file	ut_batch_evaluator.cpp
+	\brief	Batch evaluator unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Batch evaluator unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/batch_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <sstream>
+#include <stdexcept>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_BATCH
+	GATS_TEST_CASE(batch_hoist_uniform_subexpression) {
+		auto x = convert<Variable>(make<Variable>());
+		auto rate = convert<Variable>(make<Variable>());
+		auto T = convert<Variable>(make<Variable>());
+		rate->set(make_operand<Integer>(2));
+		T->set(make_operand<Integer>(5));
+
+		// x * (rate * T)
+		BatchEvaluator batch({ x, rate, T, make<Multiplication>(), make<Multiplication>() }, { x });
+		GATS_CHECK(batch.hoisted_count() == 1);
+		GATS_CHECK(batch.row_program_size() == 3);
+
+		auto results = batch.evaluate({ { make_operand<Integer>(1) }, { make_operand<Integer>(2) }, { make_operand<Integer>(3) } });
+		GATS_CHECK(results.size() == 3);
+		GATS_CHECK(value_of<Integer>(results[0]) == 10);
+		GATS_CHECK(value_of<Integer>(results[1]) == 20);
+		GATS_CHECK(value_of<Integer>(results[2]) == 30);
+	}
+
+	GATS_TEST_CASE(batch_varying_subexpression_not_hoisted) {
+		auto x = convert<Variable>(make<Variable>());
+		auto rate = convert<Variable>(make<Variable>());
+		rate->set(make_operand<Integer>(3));
+
+		// (x + 1) * rate
+		BatchEvaluator batch({ x, make<Integer>(1), make<Addition>(), rate, make<Multiplication>() }, { x });
+		GATS_CHECK(batch.hoisted_count() == 0);
+		GATS_CHECK(batch.row_program_size() == 5);
+
+		auto results = batch.evaluate({ { make_operand<Integer>(1) }, { make_operand<Integer>(4) } });
+		GATS_CHECK(value_of<Integer>(results[0]) == 6);
+		GATS_CHECK(value_of<Integer>(results[1]) == 15);
+	}
+
+	GATS_TEST_CASE(batch_all_uniform) {
+		auto rate = convert<Variable>(make<Variable>());
+		rate->set(make_operand<Integer>(7));
+
+		BatchEvaluator batch({ rate, make<Integer>(6), make<Multiplication>() }, {});
+		GATS_CHECK(batch.hoisted_count() == 1);
+		GATS_CHECK(batch.row_program_size() == 1);
+
+		auto results = batch.evaluate({ {}, {} });
+		GATS_CHECK(results.size() == 2);
+		GATS_CHECK(value_of<Integer>(results[0]) == 42);
+		GATS_CHECK(value_of<Integer>(results[1]) == 42);
+	}
+
+	GATS_TEST_CASE(batch_assignment_is_varying) {
+		auto x = convert<Variable>(make<Variable>());
+		auto y = convert<Variable>(make<Variable>());
+		y->set(make_operand<Integer>(0));
+
+		// y = x * (2 + 3)
+		BatchEvaluator batch({ y, x, make<Integer>(2), make<Integer>(3), make<Addition>(), make<Multiplication>(), make<Assignment>() }, { x });
+		GATS_CHECK(batch.hoisted_count() == 1);
+		GATS_CHECK(batch.row_program_size() == 5);
+
+		auto results = batch.evaluate({ { make_operand<Integer>(1) }, { make_operand<Integer>(2) } });
+		GATS_CHECK(value_of<Integer>(results[0]) == 5);
+		GATS_CHECK(value_of<Integer>(results[1]) == 10);
+		GATS_CHECK(value_of<Integer>(y->value()) == 10);
+	}
+
+	GATS_TEST_CASE(batch_restores_row_variables) {
+		auto x = convert<Variable>(make<Variable>());
+		x->set(make_operand<Integer>(99));
+
+		BatchEvaluator batch({ x, make<Negation>() }, { x });
+		auto results = batch.evaluate({ { make_operand<Integer>(1) } });
+		GATS_CHECK(value_of<Integer>(results[0]) == -1);
+		GATS_CHECK(value_of<Integer>(x->value()) == 99);
+	}
+
+	GATS_TEST_CASE(batch_stream_matches_evaluate) {
+		auto x = convert<Variable>(make<Variable>());
+		auto rate = convert<Variable>(make<Variable>());
+		rate->set(make_operand<Integer>(2));
+		x->set(make_operand<Integer>(99));
+
+		// x * rate + 1
+		BatchEvaluator batch({ x, rate, make<Multiplication>(), make<Integer>(1), make<Addition>() }, { x });
+		BatchEvaluator::row_list_type rows;
+		for (int i = 0; i < 7; ++i)
+			rows.push_back({ make_operand<Integer>(i) });
+
+		auto const expected = batch.evaluate(rows);
+		std::size_t n = 0;
+		bool same = true;
+		for (auto const& result : batch.stream(BatchEvaluator::row_source(rows.begin(), rows.end()), 3)) {
+			same = same && value_of<Integer>(result) == value_of<Integer>(expected[n]);
+			same = same && value_of<Integer>(x->value()) == 99;		// restored between blocks
+			++n;
+		}
+		GATS_CHECK(n == 7);
+		GATS_CHECK(same);
+		GATS_CHECK(value_of<Integer>(x->value()) == 99);
+	}
+
+	GATS_TEST_CASE(batch_stream_is_lazy) {
+		auto x = convert<Variable>(make<Variable>());
+		x->set(make_operand<Integer>(5));
+		BatchEvaluator batch({ x, make<Negation>() }, { x });
+
+		// an endless source: only the first block is ever read
+		std::size_t pulled = 0;
+		auto endless = [&](BatchEvaluator::row_type& row) {
+			row = { make_operand<Integer>(int(++pulled)) };
+			return true;
+		};
+		{
+			auto results = batch.stream(endless, 4);
+			GATS_CHECK(pulled == 0);
+			int taken = 0;
+			for (auto const& result : results) {
+				if (++taken == 2) {
+					GATS_CHECK(value_of<Integer>(result) == -2);
+					break;
+				}
+			}
+		}
+		GATS_CHECK(pulled == 4);
+		GATS_CHECK(value_of<Integer>(x->value()) == 5);
+	}
+
+	GATS_TEST_CASE(batch_stream_text_rows) {
+		auto x = convert<Variable>(make<Variable>());
+		auto y = convert<Variable>(make<Variable>());
+		BatchEvaluator batch({ x, y, make<Addition>() }, { x, y });
+
+		std::istringstream in("1 2\n\n-3, 10\n0.5 0.25\n");
+		std::vector<Operand::pointer_type> results;
+		for (auto const& result : batch.stream(BatchEvaluator::row_source(in)))
+			results.push_back(result);
+		GATS_CHECK(results.size() == 3);
+		GATS_CHECK(value_of<Integer>(results[0]) == 3);
+		GATS_CHECK(value_of<Integer>(results[1]) == 7);
+		GATS_CHECK(is<Real>(results[2]) && value_of<Real>(results[2]) == Real::value_type("0.75"));
+
+		// errors reach the consumer
+		std::istringstream bad("1 2\n3\n");
+		auto stream = batch.stream(BatchEvaluator::row_source(bad));
+		GATS_CHECK_THROW(for (auto const& result : stream) (void)result, std::runtime_error);
+		std::istringstream junk("1 two\n");
+		GATS_CHECK_THROW((void)batch.stream(BatchEvaluator::row_source(junk)).begin(), std::runtime_error);
+	}
+#endif // TEST_BATCH
@@ -0,0 +1,142 @@
+/*! \file	ut_cost_estimator.cpp
+	\brief	Cost estimator unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Static cost estimator unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/cost_estimator.hpp>
+#include <ee/integer.hpp>
+#include <ee/parser.hpp>
+#include <ee/snapshot_evaluator.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+#include <string>
+#include <vector>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_COST_ESTIMATOR
+	namespace {
+		CostEstimate estimate(std::string const& expression, CostEstimator const& estimator = CostEstimator()) {
+			Tokenizer tokenizer;
+			return estimator.estimate(Parser().parse(tokenizer.tokenize(expression)));
+		}
+	}
+
+	GATS_TEST_CASE(cost_literals_and_arithmetic) {
+		auto const literal = estimate("42");
+		GATS_CHECK(literal.units == 0.0);
+		GATS_CHECK(literal.steps == 0);
+		GATS_CHECK(literal.digits == 2.0);
+		GATS_CHECK(literal.bounded);
+
+		auto const sum = estimate("2 + 3 * 4");
+		GATS_CHECK(sum.steps == 2);
+		GATS_CHECK(sum.units > 0.0 && sum.units < 10.0);
+		GATS_CHECK(sum.bounded);
+
+		// the same operations cost more on bigger operands, and on reals
+		GATS_CHECK(estimate("2 * 3") < estimate("123456789012345678901234567890 * 123456789012345678901234567890"));
+		GATS_CHECK(estimate("2 * 3") < estimate("2.0 * 3.0"));
+	}
+
+	GATS_TEST_CASE(cost_loops_and_functions) {
+		// the factorial loop grows with the digits it produces
+		auto const small = estimate("10!");
+		auto const large = estimate("100000!");
+		GATS_CHECK(small.digits == 7.0);
+		GATS_CHECK(large.digits > 456'000.0 && large.digits < 457'000.0);
+		GATS_CHECK(large.units > 1e9);
+		GATS_CHECK(small.units * 1e6 < large.units);
+
+		// so does the integer power loop, with the exponent
+		GATS_CHECK(estimate("2 ** 10") < estimate("2 ** 100000"));
+		GATS_CHECK(estimate("2 ** 100000").units > 1e8);
+		GATS_CHECK(estimate("100000! ** 100000").units > estimate("100000!").units * 1000.0);
+
+		// a 1000-digit transcendental costs far more than a multiplication; arctan more than sqrt
+		GATS_CHECK(estimate("sin(1.0)").units > estimate("1.0 * 2.0").units * 100.0);
+		GATS_CHECK(estimate("sqrt(2)") < estimate("arctan(2)"));
+
+		// and less at a lower precision
+		GATS_CHECK(estimate("sin(1.0)", CostEstimator(100)) < estimate("sin(1.0)"));
+	}
+
+	GATS_TEST_CASE(cost_variables) {
+		Tokenizer tokenizer;
+		Parser parser;
+		auto const expression = parser.parse(tokenizer.tokenize("n!"));
+		auto const n = expression[0];
+
+		// an uninitialized variable is unknown, so the estimate is a guess
+		CostEstimator const estimator;
+		GATS_CHECK(!estimator.estimate(expression).bounded);
+
+		// a current value bounds it
+		convert<Variable>(n)->set(make_operand<Integer>(20));
+		auto const current = estimator.estimate(expression);
+		GATS_CHECK(current.bounded);
+		GATS_CHECK(current.digits == 19.0);
+
+		// a lookup overrides the current values
+		CostEstimator const lookup(0, [](Token const&) { return make_operand<Integer>(5000); });
+		GATS_CHECK(current < lookup.estimate(expression));
+		CostEstimator const none(0, [](Token const&) { return Operand::pointer_type(); });
+		GATS_CHECK(!none.estimate(expression).bounded);
+	}
+
+	GATS_TEST_CASE(cost_orders_snapshot_work) {
+		// expensive expressions among cheap ones are scheduled first; the results stay in input order
+		Tokenizer tokenizer;
+		Parser parser;
+		std::vector<TokenList> expressions;
+		std::vector<Integer::value_type> expected;
+		for (int i = 0; i < 300; ++i) {
+			bool const heavy = i % 100 == 50;
+			expressions.push_back(parser.parse(tokenizer.tokenize(heavy ? "300!" : std::to_string(i) + " * 2")));
+			Integer::value_type factorial = 1;
+			for (int f = 2; f <= 300; ++f)
+				factorial *= f;
+			expected.push_back(heavy ? factorial : Integer::value_type(i * 2));
+		}
+
+		SnapshotEvaluator evaluator(4);
+		std::vector<SnapshotEvaluator::Outcome> results(expressions.size());
+		auto const report = evaluator.evaluate(expressions, VariableSnapshot(), results);
+		GATS_CHECK(report.errors == 0);
+		GATS_CHECK(report.chunks > 1);
+		GATS_CHECK(report.estimatedUnits > 0.0);
+
+		bool same = true;
+		for (std::size_t i = 0; i < results.size(); ++i)
+			same = same && is<Integer>(results[i].value) && value_of<Integer>(results[i].value) == expected[i];
+		GATS_CHECK(same);
+	}
+#endif // TEST_COST_ESTIMATOR
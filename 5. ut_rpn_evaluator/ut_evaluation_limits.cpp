@@ -0,0 +1,113 @@
+/*! \file	ut_evaluation_limits.cpp
+	\brief	Evaluation limits unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+RPNEvaluator resource limits unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/tokenizer.hpp>
+#include <chrono>
+#include <string>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_LIMITS
+	namespace {
+		Error evaluate(RPNEvaluator& rpn, std::string const& expression) {
+			Tokenizer tokenizer;
+			return rpn.try_evaluate(Parser().parse(tokenizer.tokenize(expression))).error();
+		}
+	}
+
+	GATS_TEST_CASE(limits_steps) {
+		RPNEvaluator rpn;
+		GATS_CHECK(!evaluate(rpn, "1 + 2 + 3 + 4"));
+		GATS_CHECK(rpn.steps() == 3);
+
+		rpn.set_limits(EvaluationLimits{ 3 });
+		GATS_CHECK(!evaluate(rpn, "1 + 2 + 3 + 4"));
+		auto const error = evaluate(rpn, "1 + 2 + 3 + 4 + 5");
+		GATS_CHECK(error.code == ErrorCode::StepLimitExceeded);
+		GATS_CHECK(error.offset == 8);
+
+		// each multiplication of the loops is a step; a loop that can't finish is refused up front
+		GATS_CHECK(!evaluate(rpn, "2!"));
+		GATS_CHECK(evaluate(rpn, "3!").code == ErrorCode::StepLimitExceeded);
+		GATS_CHECK(evaluate(rpn, "100000000000!").code == ErrorCode::StepLimitExceeded);
+		GATS_CHECK(evaluate(rpn, "2 ** 100000000000").code == ErrorCode::StepLimitExceeded);
+		GATS_CHECK(rpn.steps() < 10);
+	}
+
+	GATS_TEST_CASE(limits_digits) {
+		RPNEvaluator rpn;
+		rpn.set_limits(EvaluationLimits{ 0, 100 });
+		GATS_CHECK(!evaluate(rpn, "2 ** 300"));
+		GATS_CHECK(!evaluate(rpn, "60!"));
+		GATS_CHECK(evaluate(rpn, "2 ** 1000").code == ErrorCode::DigitLimitExceeded);
+		GATS_CHECK(rpn.steps() == 1);		// refused before the loop
+		GATS_CHECK(evaluate(rpn, "100000!").code == ErrorCode::DigitLimitExceeded);
+		GATS_CHECK(rpn.steps() < 100);
+		GATS_CHECK(evaluate(rpn, "10 ** 90 * 10 ** 90").code == ErrorCode::DigitLimitExceeded);
+
+		// reals have a fixed precision, so they aren't limited
+		GATS_CHECK(!evaluate(rpn, "10.0 ** 500"));
+	}
+
+	GATS_TEST_CASE(limits_time) {
+		using namespace std::chrono;
+		RPNEvaluator rpn;
+		rpn.set_limits(EvaluationLimits{ 0, 0, milliseconds(50) });
+
+		auto const start = steady_clock::now();
+		GATS_CHECK(evaluate(rpn, "100000!").code == ErrorCode::TimeLimitExceeded);
+		GATS_CHECK(steady_clock::now() - start < seconds(2));
+		GATS_CHECK(is_limit(ErrorCode::TimeLimitExceeded) && !is_limit(ErrorCode::EvaluationFailed));
+
+		// each evaluation has its own budget
+		GATS_CHECK(!evaluate(rpn, "20!"));
+	}
+
+	GATS_TEST_CASE(limits_expression_evaluator) {
+		using namespace std::chrono;
+		ExpressionEvaluator evaluator;
+		evaluator.set_limits(EvaluationLimits{ 1'000'000, 10'000, milliseconds(100) });
+		auto const start = steady_clock::now();
+		auto const result = evaluator.try_evaluate("100000! ** 100000");
+		GATS_CHECK(!result && is_limit(result.error().code));
+		GATS_CHECK(steady_clock::now() - start < seconds(2));
+		GATS_CHECK_THROW((void)evaluator.evaluate("5000!"), std::runtime_error);
+
+		auto const small = evaluator.try_evaluate("25!");
+		GATS_CHECK(small && value_of<Integer>(*small) == Integer::value_type("15511210043330985984000000"));
+	}
+#endif // TEST_LIMITS
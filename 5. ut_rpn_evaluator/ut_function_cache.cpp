@@ -0,0 +1,105 @@
+/*! \file	ut_function_cache.cpp
+	\brief	Function memo cache unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Function memo cache unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/RPNEvaluator.hpp>
+#include <ee/function.hpp>
+#include <ee/function_cache.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_FUNCTION_CACHE
+	GATS_TEST_CASE(function_cache_one_arg) {
+		FunctionCache cache;
+		RPNEvaluator rpn;
+		rpn.use_function_cache(&cache);
+
+		auto uncached = RPNEvaluator().evaluate({ make<Real>(Real::value_type("0.5")), make<Sin>() });
+		auto first = rpn.evaluate({ make<Real>(Real::value_type("0.5")), make<Sin>() });
+		auto second = rpn.evaluate({ make<Real>(Real::value_type("0.5")), make<Sin>() });
+
+		GATS_CHECK(value_of<Real>(first) == value_of<Real>(uncached));
+		GATS_CHECK(value_of<Real>(second) == value_of<Real>(uncached));
+		GATS_CHECK(cache.statistics().misses == 1);
+		GATS_CHECK(cache.statistics().hits == 1);
+		GATS_CHECK(cache.statistics().entries == 1);
+		GATS_CHECK(cache.statistics().hit_rate() == 0.5);
+	}
+
+	GATS_TEST_CASE(function_cache_keys) {
+		FunctionCache cache;
+		RPNEvaluator rpn;
+		rpn.use_function_cache(&cache);
+
+		// Integer arguments are promoted, so sqrt(4) and sqrt(4.0) share an entry; cos(4) does not.
+		(void)rpn.evaluate({ make<Integer>(4), make<Sqrt>() });
+		(void)rpn.evaluate({ make<Real>(Real::value_type("4.0")), make<Sqrt>() });
+		(void)rpn.evaluate({ make<Integer>(4), make<Cos>() });
+		GATS_CHECK(cache.statistics().hits == 1);
+		GATS_CHECK(cache.statistics().entries == 2);
+	}
+
+	GATS_TEST_CASE(function_cache_two_arg) {
+		FunctionCache cache;
+		RPNEvaluator rpn;
+		rpn.use_function_cache(&cache);
+
+		auto r1 = rpn.evaluate({ make<Integer>(1), make<Integer>(2), make<Arctan2>() });
+		auto r2 = rpn.evaluate({ make<Integer>(2), make<Integer>(1), make<Arctan2>() });
+		auto r3 = rpn.evaluate({ make<Integer>(1), make<Integer>(2), make<Arctan2>() });
+		GATS_CHECK(value_of<Real>(r1) != value_of<Real>(r2));
+		GATS_CHECK(value_of<Real>(r1) == value_of<Real>(r3));
+		GATS_CHECK(cache.statistics().hits == 1);
+		GATS_CHECK(cache.statistics().misses == 2);
+	}
+
+	GATS_TEST_CASE(function_cache_budget) {
+		FunctionCache cache;
+		RPNEvaluator rpn;
+		rpn.use_function_cache(&cache);
+		for (int i = 1; i <= 4; ++i)
+			(void)rpn.evaluate({ make<Integer>(i), make<Exp>() });
+		GATS_CHECK(cache.statistics().entries == 4);
+
+		// keep room for about two entries
+		cache.set_budget(cache.statistics().bytes / 2);
+		GATS_CHECK(cache.statistics().entries == 2);
+		GATS_CHECK(cache.statistics().evictions == 2);
+		GATS_CHECK(cache.statistics().bytes <= cache.budget());
+
+		// the most recently used entries survive
+		(void)rpn.evaluate({ make<Integer>(4), make<Exp>() });
+		GATS_CHECK(cache.statistics().hits == 1);
+	}
+#endif // TEST_FUNCTION_CACHE
@@ -0,0 +1,173 @@
+/*! \file	ut_snapshot_evaluator.cpp
+	\brief	Snapshot evaluator unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Snapshot evaluator and thread pool unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/integer.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/rule_set.hpp>
+#include <ee/snapshot_evaluator.hpp>
+#include <ee/thread_pool.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/variable.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ut_test_phases.hpp"
+
+
+#if TEST_SNAPSHOT
+	namespace {
+		std::vector<TokenList> compile(Tokenizer& tokenizer, std::vector<std::string> const& expressions) {
+			Parser parser;
+			std::vector<TokenList> compiled;
+			for (auto const& expression : expressions)
+				compiled.push_back(parser.parse(tokenizer.tokenize(expression)));
+			return compiled;
+		}
+	}
+
+	GATS_TEST_CASE(thread_pool_parallel_for) {
+		ThreadPool pool(4);
+		GATS_CHECK(pool.size() == 4);
+
+		for (std::size_t count : { std::size_t(0), std::size_t(1), std::size_t(1000), std::size_t(100003) }) {
+			std::vector<std::atomic<int>> visits(count);
+			std::atomic<bool> badWorker{ false };
+			pool.parallel_for(count, 17, [&](std::size_t begin, std::size_t end, unsigned worker) {
+				badWorker = badWorker || worker >= pool.size();
+				for (std::size_t i = begin; i < end; ++i)
+					++visits[i];
+			});
+			bool once = true;
+			for (auto const& v : visits)
+				once = once && v == 1;
+			GATS_CHECK(once);
+			GATS_CHECK(!badWorker);
+		}
+
+		GATS_CHECK_THROW(pool.parallel_for(1000, 10, [](std::size_t begin, std::size_t, unsigned) {
+			if (begin == 500)
+				throw std::runtime_error("body failed");
+		}), std::runtime_error);
+
+		// still usable after a failed loop
+		std::atomic<std::size_t> total{ 0 };
+		pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end, unsigned) { total += end - begin; });
+		GATS_CHECK(total == 1000);
+	}
+
+	GATS_TEST_CASE(snapshot_matches_sequential) {
+		Tokenizer tokenizer;
+		std::vector<std::string> source;
+		for (int i = 0; i < 3000; ++i)
+			source.push_back("a * " + std::to_string(i) + " + max(b, " + std::to_string(i % 50) + ") - c ** 2 / (a + 1)");
+		auto const expressions = compile(tokenizer, source);
+
+		auto a = tokenizer.get_variable("a"), b = tokenizer.get_variable("b"), c = tokenizer.get_variable("c");
+		convert<Variable>(a)->set(make_operand<Integer>(3));
+		convert<Variable>(b)->set(make_operand<Integer>(20));
+		convert<Variable>(c)->set(make_operand<Integer>(-7));
+		auto const snapshot = VariableSnapshot::capture({ a, b, c });
+		GATS_CHECK(snapshot.size() == 3);
+
+		RPNEvaluator rpn;
+		std::vector<std::string> expected;
+		for (auto const& expression : expressions)
+			expected.push_back(rpn.evaluate(expression)->str());
+
+		// the live variables change; the snapshot doesn't
+		convert<Variable>(a)->set(make_operand<Integer>(1000));
+
+		SnapshotEvaluator evaluator(4);
+		std::vector<SnapshotEvaluator::Outcome> results(expressions.size());
+		auto const report = evaluator.evaluate(expressions, snapshot, results);
+		GATS_CHECK(report.parallel == expressions.size());
+		GATS_CHECK(report.errors == 0);
+
+		bool same = true;
+		for (std::size_t i = 0; i < expressions.size(); ++i)
+			same = same && !results[i].error && results[i].value && results[i].value->str() == expected[i];
+		GATS_CHECK(same);
+
+		std::vector<SnapshotEvaluator::Outcome> tooFew(10);
+		GATS_CHECK_THROW(evaluator.evaluate(expressions, snapshot, tooFew), std::invalid_argument);
+	}
+
+	GATS_TEST_CASE(snapshot_errors) {
+		auto rules = RuleSet::compile("a + 1\nunset * 2\n1 +\n7 / 0\nb", 1);
+		auto a = rules.symbols()->find("a");
+		VariableSnapshot const snapshot({ { a, make_operand<Integer>(41) }, { rules.symbols()->find("b"), nullptr } });
+
+		SnapshotEvaluator evaluator(2);
+		std::vector<SnapshotEvaluator::Outcome> results(rules.rules().size());
+		auto const report = evaluator.evaluate(rules.rules(), snapshot, results);
+		GATS_CHECK(report.errors == 4);
+		GATS_CHECK(value_of<Integer>(results[0].value) == 42);
+		GATS_CHECK(results[1].error.code == ErrorCode::VariableNotInitialized && results[1].error.offset == 0);
+		GATS_CHECK(results[2].error && (results[2].error.code == ErrorCode::InsufficientOperands || results[2].error.code == rules.rules()[2].error().code));
+		GATS_CHECK(results[3].error.code == ErrorCode::EvaluationFailed);
+		GATS_CHECK(results[4].error.code == ErrorCode::VariableNotInitialized);
+		GATS_CHECK(!convert<Variable>(a)->value());
+	}
+
+	GATS_TEST_CASE(snapshot_assignment_policies) {
+		Tokenizer tokenizer;
+		auto const expressions = compile(tokenizer, { "x = a + 1", "x * 2", "x = x * 10", "a" });
+		auto x = tokenizer.get_variable("x"), a = tokenizer.get_variable("a");
+		convert<Variable>(x)->set(make_operand<Integer>(5));
+		convert<Variable>(a)->set(make_operand<Integer>(1));
+		auto const snapshot = VariableSnapshot::capture({ x, a });
+		GATS_CHECK(SnapshotEvaluator::assigns(expressions[0]) && !SnapshotEvaluator::assigns(expressions[1]));
+
+		std::vector<SnapshotEvaluator::Outcome> results(expressions.size());
+		SnapshotEvaluator rejecting(3);
+		GATS_CHECK(rejecting.policy() == SnapshotEvaluator::AssignmentPolicy::Reject);
+		auto report = rejecting.evaluate(expressions, snapshot, results);
+		GATS_CHECK(report.rejected == 2 && report.parallel == 2 && report.serialized == 0);
+		GATS_CHECK(results[0].error.code == ErrorCode::AssignmentRejected);
+		GATS_CHECK(results[2].error.code == ErrorCode::AssignmentRejected);
+		GATS_CHECK(value_of<Integer>(results[1].value) == 10);
+		GATS_CHECK(value_of<Integer>(results[3].value) == 1);
+
+		// serialized in input order, after the parallel pass, without touching the live variables
+		SnapshotEvaluator serializing(3, SnapshotEvaluator::AssignmentPolicy::Serialize);
+		report = serializing.evaluate(expressions, snapshot, results);
+		GATS_CHECK(report.serialized == 2 && report.parallel == 2 && report.errors == 0);
+		GATS_CHECK(value_of<Integer>(results[0].value) == 2);
+		GATS_CHECK(value_of<Integer>(results[1].value) == 10);
+		GATS_CHECK(value_of<Integer>(results[2].value) == 20);
+		GATS_CHECK(report.assignments.size() == 1 && report.assignments[0].first.get() == x.get() && value_of<Integer>(report.assignments[0].second) == 20);
+		GATS_CHECK(value_of<Integer>(convert<Variable>(x)->value()) == 5);
+	}
+#endif // TEST_SNAPSHOT
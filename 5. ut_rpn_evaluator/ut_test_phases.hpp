@@ -34,4 +34,11 @@
 
 #define TEST_PARSER false
 
+#define TEST_BATCH true
+#define TEST_FUNCTION_CACHE true
+#define TEST_SNAPSHOT true
+#define TEST_COST_ESTIMATOR true
+#define TEST_LIMITS true
+#define TEST_ADMISSION true
+
 #define TEST_GREGORIAN false
@@ -0,0 +1,73 @@
+/*! \file	ut_benchmarks.cpp
+	\brief	Expression evaluator benchmarks.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Hot-path benchmarks for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/batch_evaluator.hpp>
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <string>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_BENCHMARKS
+	GATS_BENCHMARK(bench_integer_arithmetic) {
+		static ExpressionEvaluator evaluator;
+		gats::do_not_optimize(evaluator.evaluate("(17 + 25) * 3 - 96 / 4 % 5"));
+	}
+
+	GATS_BENCHMARK(bench_variable_assignment) {
+		static ExpressionEvaluator evaluator;
+		gats::do_not_optimize(evaluator.evaluate("total = 3 * 7 + 2"));
+	}
+
+	GATS_BENCHMARK(bench_factorial) {
+		static ExpressionEvaluator evaluator;
+		gats::do_not_optimize(evaluator.evaluate("100!"));
+	}
+
+	GATS_BENCHMARK(bench_batch_rows) {
+		static ExpressionEvaluator evaluator;
+		static BatchEvaluator const batch = [] {
+			(void)evaluator.evaluate("rate = 5");
+			return evaluator.compile_batch("x * (rate * 12) + 1", { "x" });
+		}();
+		static BatchEvaluator::row_list_type const rows = [] {
+			BatchEvaluator::row_list_type rows;
+			for (int i = 0; i < 100; ++i)
+				rows.push_back({ make_operand<Integer>(i) });
+			return rows;
+		}();
+		gats::do_not_optimize(batch.evaluate(rows));
+	}
+#endif // TEST_BENCHMARKS
@@ -0,0 +1,141 @@
+/*! \file	ut_evaluate_async.cpp
+	\brief	Asynchronous evaluation unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+evaluate_async() and ThreadPool::submit() unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/thread_pool.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_EVALUATE_ASYNC
+	GATS_TEST_CASE(thread_pool_submit) {
+		std::atomic<int> count{ 0 };
+		{
+			ThreadPool pool(3);
+			for (int i = 0; i < 100; ++i)
+				pool.submit([&] { ++count; });
+			pool.submit([] { throw std::runtime_error("discarded"); });
+
+			// a loop still runs while tasks are queued
+			std::atomic<std::size_t> visits{ 0 };
+			pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end, unsigned) { visits += end - begin; });
+			GATS_CHECK(visits == 1000);
+		}
+		GATS_CHECK(count == 100);		// the destructor runs the queued tasks
+
+		// without pool threads, a task runs at once
+		ThreadPool single(1);
+		bool ran = false;
+		single.submit([&] { ran = true; });
+		GATS_CHECK(ran);
+	}
+
+	GATS_TEST_CASE(evaluate_async_in_order) {
+		ExpressionEvaluator evaluator;
+		auto sum = evaluator.evaluate_async("1 + 2");
+		auto assign = evaluator.evaluate_async("x = 5");
+		auto use = evaluator.evaluate_async("x * 2");
+		auto reassign = evaluator.evaluate_async("x = 7");
+
+		auto const s = sum.get();
+		GATS_CHECK(s && value_of<Integer>(*s) == 3);
+		auto const a = assign.get();
+		GATS_CHECK(a && is<Integer>(*a) && value_of<Integer>(*a) == 5);		// the value, not the variable, which is now 7
+		auto const u = use.get();
+		GATS_CHECK(u && value_of<Integer>(*u) == 10);
+		GATS_CHECK(reassign.get().has_value());
+
+		auto const bad = evaluator.evaluate_async("1 +").get();
+		GATS_CHECK(!bad);
+	}
+
+	GATS_TEST_CASE(evaluate_async_many_evaluators) {
+		std::vector<std::unique_ptr<ExpressionEvaluator>> evaluators;
+		std::vector<std::future<Expected<ExpressionEvaluator::result_type>>> futures;
+		for (int e = 0; e < 8; ++e) {
+			evaluators.push_back(std::make_unique<ExpressionEvaluator>());
+			for (int i = 0; i < 20; ++i)
+				futures.push_back(evaluators.back()->evaluate_async(std::to_string(e) + " * 100 + " + std::to_string(i)));
+		}
+		bool correct = true;
+		for (std::size_t k = 0; k < futures.size(); ++k) {
+			auto const result = futures[k].get();
+			correct = correct && result && value_of<Integer>(*result) == int(k / 20 * 100 + k % 20);
+		}
+		GATS_CHECK(correct);
+	}
+
+	GATS_TEST_CASE(evaluate_async_cancel) {
+		using namespace std::chrono;
+		ExpressionEvaluator evaluator;
+
+		// cancelled while running: the factorial loop notices
+		CancellationToken running;
+		auto const start = steady_clock::now();
+		auto slow = evaluator.evaluate_async("100000!", running);
+		std::this_thread::sleep_for(milliseconds(20));
+		running.cancel();
+		auto const stopped = slow.get();
+		GATS_CHECK(!stopped && stopped.error().code == ErrorCode::Cancelled);
+		GATS_CHECK(steady_clock::now() - start < seconds(5));
+
+		// cancelled before it starts
+		CancellationToken early;
+		early.cancel();
+		auto const skipped = evaluator.evaluate_async("2 + 2", early).get();
+		GATS_CHECK(!skipped && skipped.error().code == ErrorCode::Cancelled);
+
+		// the evaluator carries on
+		auto const after = evaluator.evaluate_async("2 + 2").get();
+		GATS_CHECK(after && value_of<Integer>(*after) == 4);
+	}
+
+	GATS_TEST_CASE(evaluate_async_outlived) {
+		// the destructor waits for the pending evaluations
+		std::future<Expected<ExpressionEvaluator::result_type>> pending;
+		{
+			ExpressionEvaluator evaluator;
+			pending = evaluator.evaluate_async("300!");
+		}
+		GATS_CHECK(pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+		GATS_CHECK(pending.get().has_value());
+	}
+#endif // TEST_EVALUATE_ASYNC
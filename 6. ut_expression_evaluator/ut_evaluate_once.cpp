@@ -0,0 +1,75 @@
+/*! \file	ut_evaluate_once.cpp
+	\brief	Fused one-shot evaluation unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Fused one-shot evaluation unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <string>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_EVALUATE_ONCE
+	GATS_TEST_CASE(evaluate_once_matches_evaluate) {
+		char const* expressions[] = {
+			"1 + 2 * 3", "-(4 - 6) ** 2 ** 3", "5! / 3 % 7", "2.5 * -4", "not (1 < 2) or 3 >= 3 and true",
+			"max(1, 2 * 3) + arctan2(1.0, 2)", "sqrt(16) + abs(-3)", "(((7)))", "0b1011 + 1",
+		};
+		ExpressionEvaluator twoPass, onePass;
+		for (auto expr : expressions)
+			GATS_CHECK(twoPass.evaluate(expr) == onePass.evaluate_once(expr));
+	}
+
+	GATS_TEST_CASE(evaluate_once_variables) {
+		ExpressionEvaluator ee;
+		(void)ee.evaluate_once("x = 3");
+		(void)ee.evaluate_once("y = x * 2 + 1");
+		GATS_CHECK(value_of<Integer>(ee.evaluate("x + y")) == 10);
+	}
+
+	GATS_TEST_CASE(evaluate_once_long_expression) {
+		std::string expr = "0";
+		for (int i = 1; i <= 2000; ++i)
+			expr += " + " + std::to_string(i);
+		GATS_CHECK(value_of<Integer>(ExpressionEvaluator().evaluate_once(expr)) == 2001000);
+	}
+
+	GATS_TEST_CASE(evaluate_once_errors) {
+		ExpressionEvaluator ee;
+		GATS_CHECK_THROW((void)ee.evaluate_once("1 + $"), Tokenizer::XBadCharacter);
+		GATS_CHECK_THROW((void)ee.evaluate_once("(1 + 2"), std::runtime_error);
+		GATS_CHECK_THROW((void)ee.evaluate_once(""), std::runtime_error);
+		// state from a failed expression does not leak into the next one
+		GATS_CHECK(value_of<Integer>(ee.evaluate_once("2 * 21")) == 42);
+	}
+#endif // TEST_EVALUATE_ONCE
@@ -0,0 +1,117 @@
+/*! \file	ut_mpmc_ring.cpp
+	\brief	MPMC ring unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Lock-free MPMC ring unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/mpmc_ring.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_MPMC_RING
+	GATS_TEST_CASE(mpmc_ring_single_thread) {
+		MpmcRing<std::uint32_t, 4> ring;
+		std::uint32_t value = 0;
+		GATS_CHECK(!ring.try_pop(value));
+
+		// several laps, so every cell is reused
+		bool inOrder = true;
+		for (std::uint32_t lap = 0; lap < 5; ++lap) {
+			for (std::uint32_t i = 0; i < 4; ++i)
+				inOrder = inOrder && ring.try_push(lap * 4 + i);
+			inOrder = inOrder && !ring.try_push(99) && ring.size_approx() == 4;
+			for (std::uint32_t i = 0; i < 4; ++i)
+				inOrder = inOrder && ring.try_pop(value) && value == lap * 4 + i;
+			inOrder = inOrder && !ring.try_pop(value);
+		}
+		GATS_CHECK(inOrder);
+
+		GATS_CHECK(ring.try_push(7));
+		ring.init();
+		GATS_CHECK(!ring.try_pop(value));
+	}
+
+	GATS_TEST_CASE(mpmc_ring_many_threads) {
+		constexpr unsigned producers = 4, consumers = 4;
+		constexpr std::uint64_t perProducer = 50'000;
+		auto ring = std::make_unique<MpmcRing<std::uint64_t, 64>>();
+
+		// each value is (producer << 32) | sequence; every value must arrive once, each producer's in order
+		std::vector<std::vector<std::uint64_t>> received(consumers);
+		std::atomic<std::uint64_t> popped{ 0 };
+		std::vector<std::thread> threads;
+		for (unsigned p = 0; p < producers; ++p)
+			threads.emplace_back([&, p] {
+				for (std::uint64_t i = 0; i < perProducer; ++i)
+					while (!ring->try_push((std::uint64_t(p) << 32) | i))
+						std::this_thread::yield();
+			});
+		for (unsigned c = 0; c < consumers; ++c)
+			threads.emplace_back([&, c] {
+				for (std::uint64_t value; popped < producers * perProducer; )
+					if (ring->try_pop(value)) {
+						received[c].push_back(value);
+						++popped;
+					}
+					else
+						std::this_thread::yield();
+			});
+		for (auto& t : threads)
+			t.join();
+
+		std::vector<std::uint64_t> counts(producers, 0);
+		bool ordered = true;
+		for (auto const& values : received) {
+			std::vector<std::int64_t> last(producers, -1);
+			for (auto value : values) {
+				auto const producer = unsigned(value >> 32);
+				auto const sequence = std::int64_t(value & 0xFFFFFFFF);
+				ordered = ordered && producer < producers && sequence > last[producer];
+				if (producer < producers) {
+					last[producer] = sequence;
+					++counts[producer];
+				}
+			}
+		}
+		GATS_CHECK(ordered);
+		bool complete = true;
+		for (auto count : counts)
+			complete = complete && count == perProducer;
+		GATS_CHECK(complete);
+		GATS_CHECK(popped == producers * perProducer);
+	}
+#endif // TEST_MPMC_RING
@@ -0,0 +1,162 @@
+/*! \file	ut_pipeline.cpp
+	\brief	Pipelined evaluator unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Pipelined evaluator and SPSC queue unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/pipeline_evaluator.hpp>
+#include <ee/spsc_queue.hpp>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_PIPELINE
+	namespace {
+		/*! Runs lines through a pipeline, collecting the outcomes. */
+		std::vector<PipelineEvaluator::Outcome> run_pipeline(std::vector<std::string> const& lines, std::size_t queueCapacity = PipelineEvaluator::default_queue_capacity_c) {
+			PipelineEvaluator pipeline(queueCapacity);
+			std::size_t next = 0;
+			std::vector<PipelineEvaluator::Outcome> outcomes;
+			(void)pipeline.run(
+				[&](std::string& line) {
+					if (next == lines.size())
+						return false;
+					line = lines[next++];
+					return true;
+				},
+				[&](PipelineEvaluator::Outcome const& outcome) { outcomes.push_back(outcome); });
+			return outcomes;
+		}
+	}
+
+	GATS_TEST_CASE(spsc_queue_fifo) {
+		SpscQueue<std::uint64_t> queue(4);
+		GATS_CHECK(queue.capacity() == 4);
+
+		constexpr std::uint64_t count = 100'000;
+		std::thread producer([&] {
+			for (std::uint64_t i = 0; i < count; ++i)
+				queue.push(i);
+			queue.close();
+		});
+
+		bool inOrder = true;
+		std::uint64_t received = 0;
+		for (std::uint64_t value; queue.pop(value); ++received)
+			inOrder = inOrder && value == received;
+		producer.join();
+
+		GATS_CHECK(inOrder);
+		GATS_CHECK(received == count);
+		GATS_CHECK(queue.drained());
+		GATS_CHECK(queue.statistics().pushes == count);
+		GATS_CHECK(queue.statistics().mean_occupancy() <= 4.0);
+	}
+
+	GATS_TEST_CASE(spsc_queue_try_operations) {
+		SpscQueue<int> queue(3);
+		GATS_CHECK(queue.capacity() == 4);
+		int value = 0;
+		GATS_CHECK(!queue.try_pop(value));
+		for (int i = 0; i < 4; ++i)
+			GATS_CHECK(queue.try_push(i));
+		int extra = 4;
+		GATS_CHECK(!queue.try_push(extra));
+		GATS_CHECK(queue.try_pop(value) && value == 0);
+		GATS_CHECK(queue.try_push(extra));
+		queue.close();
+		for (int expected = 1; expected <= 4; ++expected)
+			GATS_CHECK(queue.pop(value) && value == expected);
+		GATS_CHECK(!queue.pop(value));
+	}
+
+	GATS_TEST_CASE(pipeline_matches_sequential) {
+		std::vector<std::string> lines = {
+			"1 + 2 * 3", "", "x = 4", "x ** 2", "(1 + 2", "y = x!", "1 $ 2", "y / 0", "   ",
+			"sqrt(y) + x", "2 * sin 3", "1 2", ")", "arctan2(x, 1)", "y"
+		};
+		for (int i = 0; i < 500; ++i)
+			lines.push_back("y = y + " + std::to_string(i % 7) + " * x");
+
+		// a tiny queue capacity makes the stages stall on each other
+		for (std::size_t capacity : { std::size_t(2), PipelineEvaluator::default_queue_capacity_c }) {
+			auto outcomes = run_pipeline(lines, capacity);
+			GATS_CHECK(outcomes.size() == lines.size());
+
+			ExpressionEvaluator sequential;
+			bool allMatch = outcomes.size() == lines.size();
+			for (std::size_t i = 0; allMatch && i < lines.size(); ++i) {
+				auto const& outcome = outcomes[i];
+				allMatch = outcome.line == i;
+				if (lines[i].find_first_not_of(' ') == std::string::npos) {
+					allMatch = allMatch && !outcome.value && !outcome.error;
+					continue;
+				}
+				auto expected = sequential.try_evaluate(lines[i]);
+				if (!expected)
+					allMatch = allMatch && outcome.error.code == expected.error().code && outcome.error.offset == expected.error().offset;
+				else
+					allMatch = allMatch && !outcome.error && outcome.value && outcome.value->str() == (*expected)->str();
+				if (!allMatch)
+					GATS_FAIL("mismatch at line " + std::to_string(i) + ": " + lines[i]);
+			}
+			GATS_CHECK(allMatch);
+		}
+	}
+
+	GATS_TEST_CASE(pipeline_statistics) {
+		PipelineEvaluator pipeline(8);
+		int next = 0;
+		std::uint64_t written = 0;
+		auto stats = pipeline.run(
+			[&](std::string& line) {
+				if (next == 1000)
+					return false;
+				line = next % 10 == 0 ? "1 +" : std::to_string(next) + " * 2";
+				++next;
+				return true;
+			},
+			[&](PipelineEvaluator::Outcome const&) { ++written; });
+
+		GATS_CHECK(stats.lines == 1000);
+		GATS_CHECK(written == 1000);
+		GATS_CHECK(stats.errors == 100);
+		GATS_CHECK(stats.queues.size() == 6);
+		for (auto const& queue : stats.queues)
+			GATS_CHECK(queue.statistics.capacity == 8);
+		GATS_CHECK(stats.queues.front().statistics.pushes == 1000);
+	}
+#endif // TEST_PIPELINE
@@ -0,0 +1,136 @@
+/*! \file	ut_result_cache.cpp
+	\brief	Result cache unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Result cache unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <ee/result_cache.hpp>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_RESULT_CACHE
+	GATS_TEST_CASE(result_cache_hit) {
+		ResultCache cache;
+		ExpressionEvaluator ee;
+		ee.use_result_cache(&cache);
+		(void)ee.evaluate("a = 2");
+		(void)ee.evaluate("b = 3");
+
+		auto first = ee.evaluate("a + b * 4");
+		auto second = ee.evaluate("a + 4 * b");	// same canonical form
+		GATS_CHECK(value_of<Integer>(first) == 14);
+		GATS_CHECK(first == second);
+		GATS_CHECK(cache.statistics().misses == 1);
+		GATS_CHECK(cache.statistics().hits == 1);
+		GATS_CHECK(cache.statistics().bypasses == 2);
+	}
+
+	GATS_TEST_CASE(result_cache_inputs) {
+		ResultCache cache;
+		ExpressionEvaluator ee;
+		ee.use_result_cache(&cache);
+		(void)ee.evaluate("x = 5");
+		GATS_CHECK(value_of<Integer>(ee.evaluate("x * x")) == 25);
+
+		// a new value of a variable read by the expression is a new key
+		(void)ee.evaluate("x = 6");
+		GATS_CHECK(value_of<Integer>(ee.evaluate("x * x")) == 36);
+		GATS_CHECK(cache.statistics().hits == 0);
+
+		(void)ee.evaluate("x = 5");
+		GATS_CHECK(value_of<Integer>(ee.evaluate("x * x")) == 25);
+		GATS_CHECK(cache.statistics().hits == 1);
+	}
+
+	GATS_TEST_CASE(result_cache_tiny_reals) {
+		ResultCache cache;
+		ExpressionEvaluator ee, uncached;
+		ee.use_result_cache(&cache);
+
+		// values that differ only past Real::str()'s 1000 decimals are different inputs
+		for (auto assignment : { "x = 1.0 / 10 ** 1200", "x = 3.0 / 10 ** 1200" }) {
+			(void)ee.evaluate(assignment);
+			(void)uncached.evaluate(assignment);
+			GATS_CHECK(value_of<Real>(ee.evaluate("x * 2")) == value_of<Real>(uncached.evaluate("x * 2")));
+		}
+		GATS_CHECK(cache.statistics().hits == 0);
+		GATS_CHECK(cache.statistics().misses == 2);
+	}
+
+	GATS_TEST_CASE(result_cache_bypass) {
+		ResultCache cache;
+		ExpressionEvaluator ee;
+		ee.use_result_cache(&cache);
+		(void)ee.evaluate("y = 1");
+		(void)ee.evaluate("y = y + 1");
+		(void)ee.evaluate("y = y + 1");
+		GATS_CHECK(value_of<Integer>(ee.evaluate("y + 0")) == 3);
+		GATS_CHECK(cache.statistics().bypasses == 3);
+		GATS_CHECK(cache.statistics().entries == 1);
+
+		// uninitialized variables are not cached and still report the error
+		GATS_CHECK_THROW((void)ee.evaluate("z + 1"), std::runtime_error);
+		GATS_CHECK(cache.statistics().bypasses == 4);
+	}
+
+	GATS_TEST_CASE(result_cache_ttl) {
+		ResultCache cache(ResultCache::default_capacity_c, ResultCache::clock_type::duration::zero());
+		ExpressionEvaluator ee;
+		ee.use_result_cache(&cache);
+		(void)ee.evaluate("2 + 3");
+		(void)ee.evaluate("2 + 3");
+		GATS_CHECK(cache.statistics().hits == 0);
+		GATS_CHECK(cache.statistics().expirations == 1);
+
+		cache.purge_expired();
+		GATS_CHECK(cache.statistics().entries == 0);
+	}
+
+	GATS_TEST_CASE(result_cache_capacity) {
+		ResultCache cache(2);
+		ExpressionEvaluator ee;
+		ee.use_result_cache(&cache);
+		(void)ee.evaluate("1 + 1");
+		(void)ee.evaluate("2 + 2");
+		(void)ee.evaluate("1 + 1");		// most recently used
+		(void)ee.evaluate("3 + 3");		// evicts 2 + 2
+		GATS_CHECK(cache.statistics().entries == 2);
+		GATS_CHECK(cache.statistics().evictions == 1);
+
+		(void)ee.evaluate("1 + 1");
+		(void)ee.evaluate("2 + 2");
+		GATS_CHECK(cache.statistics().hits == 2);
+		GATS_CHECK(cache.statistics().misses == 4);
+	}
+#endif // TEST_RESULT_CACHE
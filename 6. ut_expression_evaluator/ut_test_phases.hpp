@@ -37,3 +37,11 @@
 
 
 #define TEST_GREGORIAN false
+
+#define TEST_RESULT_CACHE true
+#define TEST_EVALUATE_ONCE true
+#define TEST_TRY_API true
+#define TEST_PIPELINE true
+#define TEST_MPMC_RING true
+#define TEST_EVALUATE_ASYNC true
+#define TEST_BENCHMARKS true
@@ -0,0 +1,125 @@
+/*! \file	ut_try_api.cpp
+	\brief	Non-throwing try_ interface unit test.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Non-throwing try_ interface unit test for Expression Evaluator Project.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+// unit test library
+#include <gats/TestApp.hpp>
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <stdexcept>
+#include <string>
+
+#include "ut_test_phases.hpp"
+
+
+
+#if TEST_TRY_API
+	namespace {
+		/*! Gets the message of the exception evaluate() throws, or an empty string. */
+		std::string thrown_message(ExpressionEvaluator& ee, std::string const& expr) {
+			try {
+				(void)ee.evaluate(expr);
+			}
+			catch (std::exception const& e) {
+				return e.what();
+			}
+			return {};
+		}
+	}
+
+	GATS_TEST_CASE(try_evaluate_success) {
+		char const* expressions[] = { "1 + 2 * 3", "-(4 - 6) ** 2", "5! / 3 % 7", "2.5 * -4", "max(1, 2 * 3) + sqrt(16)" };
+		ExpressionEvaluator throwing, nonThrowing;
+		for (auto expr : expressions) {
+			auto result = nonThrowing.try_evaluate(expr);
+			GATS_CHECK(result.has_value());
+			GATS_CHECK(!result.error());
+			GATS_CHECK(*result == throwing.evaluate(expr));
+		}
+	}
+
+	GATS_TEST_CASE(try_evaluate_error_offsets) {
+		struct { char const* expr; ErrorCode code; std::size_t offset; } const cases[] = {
+			{ "1 + $ 2",		ErrorCode::BadCharacter,				4 },
+			{ "2 * sin 3",		ErrorCode::FunctionWithoutParenthesis,	8 },
+			{ "1 + 2)",			ErrorCode::UnmatchedRightParenthesis,	5 },
+			{ "(1 + 2",			ErrorCode::MissingRightParenthesis,		6 },
+			{ "1 +",			ErrorCode::InsufficientOperands,		3 },
+			{ "undefinedVar + 1",	ErrorCode::VariableNotInitialized,	16 },
+			{ "4 = 5",			ErrorCode::AssignmentToNonVariable,		5 },
+		};
+		ExpressionEvaluator ee;
+		for (auto const& c : cases) {
+			auto result = ee.try_evaluate(c.expr);
+			GATS_CHECK(!result.has_value());
+			GATS_CHECK(result.error().code == c.code);
+			GATS_CHECK(result.error().offset == c.offset);
+		}
+	}
+
+	GATS_TEST_CASE(try_evaluate_library_failure) {
+		ExpressionEvaluator ee;
+		auto result = ee.try_evaluate("1 / 0");
+		GATS_CHECK(!result.has_value());
+		GATS_CHECK(result.error().code == ErrorCode::EvaluationFailed);
+	}
+
+	GATS_TEST_CASE(try_stages) {
+		Tokenizer tokenizer;
+		auto tokens = tokenizer.try_tokenize("(1 + 2");
+		GATS_CHECK(tokens.has_value());
+		GATS_CHECK(!tokenizer.try_tokenize("1 # 2").has_value());
+		GATS_CHECK(tokenizer.try_tokenize("1 # 2").error().offset == 2);
+
+		Parser parser;
+		auto postfix = parser.try_parse(*tokens);
+		GATS_CHECK(!postfix.has_value());
+		GATS_CHECK(postfix.error().code == ErrorCode::MissingRightParenthesis);
+		GATS_CHECK(postfix.error().offset == tokens->size());
+
+		postfix = parser.try_parse(*tokenizer.try_tokenize("1 2"));
+		GATS_CHECK(postfix.has_value());
+
+		RPNEvaluator rpn;
+		auto result = rpn.try_evaluate(*postfix);
+		GATS_CHECK(!result.has_value());
+		GATS_CHECK(result.error().code == ErrorCode::TooManyOperands);
+	}
+
+	GATS_TEST_CASE(throwing_wrappers_keep_messages) {
+		ExpressionEvaluator ee;
+		GATS_CHECK_THROW((void)ee.evaluate("1 + $"), Tokenizer::XBadCharacter);
+		GATS_CHECK_THROW((void)ee.evaluate("1 + 2)"), Parser::XParser);
+		GATS_CHECK(thrown_message(ee, "1 + 2)") == message(ErrorCode::UnmatchedRightParenthesis));
+		GATS_CHECK(thrown_message(ee, "(1 + 2") == message(ErrorCode::MissingRightParenthesis));
+		GATS_CHECK(thrown_message(ee, "1 +") == message(ErrorCode::InsufficientOperands));
+		GATS_CHECK(thrown_message(ee, "undefinedVar + 1") == message(ErrorCode::VariableNotInitialized));
+	}
+#endif
@@ -9,6 +9,13 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added optional FunctionCache for pure function calls.
+	Added incremental push()/finish() interface.
+	Added try_evaluate(), try_push(), try_finish().
+	Added EvaluationLimits.
+	Added use_cancellation().
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -32,12 +39,75 @@ stipulated in the agreement/contract under which
 the program(s) have been supplied.
 =============================================================*/
 
+#include <ee/cancellation_token.hpp>
+#include <ee/error.hpp>
+#include <ee/integer.hpp>
 #include <ee/operand.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+class FunctionCache;
+
+
+
+/*!	Resource limits of one evaluation; zero means no limit.
+	An evaluation that exceeds one stops with StepLimitExceeded, DigitLimitExceeded or TimeLimitExceeded.
+	*/
+struct EvaluationLimits {
+	std::uint64_t	maxSteps = 0;		/// operations; each multiplication of the Factorial and Power loops is one.
+	std::size_t		maxDigits = 0;		/// digits of an integer, rounded up to whole 64-bit limbs (about 19 digits).
+	std::chrono::steady_clock::duration	timeLimit{};	/// wall-clock time from the start of the evaluation.
+};
+
+
+/*!	RPNEvaluator evaluates postfix token sequences.
 
-class RPNEvaluator {
+	evaluate() evaluates a whole list.  As a TokenSink, push() evaluates one token at a time
+	and finish() returns the result, so the parser can feed it directly.
+	*/
+class RPNEvaluator : public TokenSink {
 	RPNEvaluator(RPNEvaluator const&) = delete;
 	RPNEvaluator& operator = (RPNEvaluator const&) = delete;
+
+	FunctionCache*	functionCache_m = nullptr;
+	OperandList		stack_m;
+	EvaluationLimits	limits_m;
+	std::size_t		maxLimbs_m = 0;				/// maxDigits in limbs; 0 for no limit.
+	std::uint64_t	steps_m = 0;				/// steps taken since reset().
+	std::chrono::steady_clock::time_point	deadline_m;
+	CancellationToken const*	cancel_m = nullptr;
 public:
 	RPNEvaluator() = default;
 	[[nodiscard]] Operand::pointer_type evaluate( TokenList const& container );
+
+	void push(Token::pointer_type const& token) override;
+	[[nodiscard]] Operand::pointer_type finish();
+
+	/*! Clears the stack and starts a new evaluation, with a fresh budget. */
+	void reset();
+
+	[[nodiscard]] Expected<Operand::pointer_type> try_evaluate(TokenList const& rpnExpression);
+	[[nodiscard]] ErrorCode try_push(Token::pointer_type const& token) noexcept;
+	[[nodiscard]] Expected<Operand::pointer_type> try_finish();
+
+	/*! Memoizes transcendental function calls in 'cache'; nullptr (the default) disables memoization. */
+	void use_function_cache(FunctionCache* cache) { functionCache_m = cache; }
+	[[nodiscard]] FunctionCache* function_cache() const { return functionCache_m; }
+
+	/*! Limits the evaluations that start after the next reset(). */
+	void set_limits(EvaluationLimits const& limits);
+	[[nodiscard]] EvaluationLimits const& limits() const { return limits_m; }
+	[[nodiscard]] std::uint64_t steps() const { return steps_m; }
+
+	/*! Stops evaluations with ErrorCode::Cancelled once 'token' is cancelled; it is checked where the limits are.
+		nullptr (the default) disables; the token must outlive its use.
+		*/
+	void use_cancellation(CancellationToken const* token) { cancel_m = token; }
+
+private:
+	[[nodiscard]] ErrorCode _evaluate(Token::pointer_type const& token);
+	[[nodiscard]] ErrorCode _apply(Token::pointer_type const& token);
+	[[nodiscard]] ErrorCode _checkpoint();
+	[[nodiscard]] bool _fits(Integer::value_type const& value) const { return maxLimbs_m == 0 || value.backend().size() <= maxLimbs_m; }
 };
@@ -0,0 +1,79 @@
+#pragma once
+/*!	\file	admission.hpp
+	\brief	Admission control declarations.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declarations of the admission decision made for each line an
+evaluation server receives.
+
+	struct AdmissionLoad
+	enum class Admission
+	predicted_wait()
+	admit()
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+
+/*! The load a line meets when it arrives. */
+struct AdmissionLoad {
+	std::uint64_t	waiting = 0;		/// lines waiting in the line's class and the classes above it, over all sessions.
+	std::uint64_t	classWaiting = 0;	/// lines waiting in the line's class.
+	std::uint64_t	backlog = 0;		/// lines of the line's own session not yet evaluated.
+	double			lineSeconds = 0.0;	/// recent evaluation time per line.
+	unsigned		workers = 1;
+};
+
+
+/*! Outcome of an admission decision. */
+enum class Admission { Admitted, QueueFull, DeadlineMissed };
+
+
+/*!	Predicts how long a new line waits before a worker evaluates it.
+	The waiting lines are shared by the workers, but a session has one batch in flight at a time, so
+	its own backlog is evaluated one line after another on a single worker.
+	*/
+[[nodiscard]] inline std::chrono::duration<double> predicted_wait(AdmissionLoad const& load) {
+	double const shared = double(load.waiting) * load.lineSeconds / double(std::max(load.workers, 1u));
+	double const serial = double(load.backlog) * load.lineSeconds;
+	return std::chrono::duration<double>(std::max(shared, serial));
+}
+
+
+/*!	Decides whether a line is queued for evaluation.
+	@param load [in] the load the line meets.
+	@param maxQueued [in] lines allowed to wait in one class.
+	@param deadline [in] time allowed from arrival to evaluation; zero for none.
+	*/
+[[nodiscard]] inline Admission admit(AdmissionLoad const& load, std::size_t maxQueued, std::chrono::duration<double> deadline) {
+	if (load.classWaiting >= maxQueued)
+		return Admission::QueueFull;
+	if (deadline.count() > 0 && predicted_wait(load) > deadline)
+		return Admission::DeadlineMissed;
+	return Admission::Admitted;
+}
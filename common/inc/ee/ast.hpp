@@ -0,0 +1,103 @@
+#pragma once
+/*!	\file	ast.hpp
+	\brief	Ast class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the Ast class, an arena-allocated abstract
+syntax tree of an expression.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+/*!	Ast is an expression tree stored in two arrays: the nodes, and the child indices of every node.
+
+	Nodes are added after their children, so the root is the last node.
+	The children of a node are a contiguous run of the child index array.
+	*/
+class Ast {
+// TYPES
+public:
+	using index_type = std::uint32_t;
+
+	/*! Node categories. */
+	enum class Kind : std::uint8_t {
+		Literal,		/// Integer, Real, Boolean, or constant (pi, e, true, ...).
+		Variable,
+		Prefix,			/// unary operator: Identity, Negation, Not.
+		Postfix,		/// postfix operator: Factorial.
+		Binary,			/// binary operator, including Assignment.
+		Call			/// function call; one child per argument.
+	};
+
+	/*! Location of a node's source text: the whole subexpression, not only the operator. */
+	struct Span {
+		std::uint32_t	offset = 0;
+		std::uint32_t	length = 0;
+
+		[[nodiscard]] constexpr std::uint32_t end() const { return offset + length; }
+	};
+
+	struct Node {
+		Token::pointer_type	token;
+		index_type			firstChild = 0;		/// index of the first child index in children().
+		std::uint32_t		childCount = 0;
+		Span				span;
+		Kind				kind = Kind::Literal;
+	};
+
+// ATTRIBUTES
+private:
+	std::vector<Node>		nodes_m;
+	std::vector<index_type>	children_m;
+
+// OPERATIONS
+public:
+	Ast() = default;
+
+	/*! Adds a node whose children are the given, already added, nodes.
+		@return the index of the new node.
+		*/
+	index_type add(Kind kind, Token::pointer_type const& token, Span span, std::span<index_type const> children = {});
+
+	void clear() { nodes_m.clear(); children_m.clear(); }
+	void reserve(std::size_t nodeCount) { nodes_m.reserve(nodeCount); children_m.reserve(nodeCount); }
+
+	[[nodiscard]] bool empty() const { return nodes_m.empty(); }
+	[[nodiscard]] std::size_t size() const { return nodes_m.size(); }
+	[[nodiscard]] index_type root() const { return index_type(nodes_m.size() - 1); }
+	[[nodiscard]] Node const& operator [] (index_type index) const { return nodes_m[index]; }
+	[[nodiscard]] std::vector<Node> const& nodes() const { return nodes_m; }
+
+	/*! Gets the child node indices of a node. */
+	[[nodiscard]] std::span<index_type const> children(index_type index) const {
+		return std::span<index_type const>(children_m).subspan(nodes_m[index].firstChild, nodes_m[index].childCount);
+	}
+
+	[[nodiscard]] TokenList to_rpn() const;
+};
@@ -0,0 +1,116 @@
+#pragma once
+/*!	\file	batch_evaluator.hpp
+	\brief	BatchEvaluator class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the BatchEvaluator class, which evaluates one
+RPN expression over many rows of variable bindings.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+	Added stream() and row_source()
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/generator.hpp>
+#include <ee/operand.hpp>
+#include <ee/variable.hpp>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+
+/*!	BatchEvaluator evaluates a compiled RPN expression once per row of variable values.
+
+	At construction every subexpression is classified as 'uniform' (depends only on literals
+	and on variables that are the same for every row) or 'varying' (depends on a row variable,
+	an assignment or a previous result).  Each maximal uniform subexpression is evaluated once
+	per batch and its value is broadcast to every row, so only the varying part runs per row.
+	*/
+class BatchEvaluator {
+// TYPES
+public:
+	using variable_list_type	= std::vector<Variable::pointer_type>;
+	using row_type				= std::vector<Operand::pointer_type>;
+	using row_list_type			= std::vector<row_type>;
+	using result_list_type		= std::vector<Operand::pointer_type>;
+
+	/*! Fills in the next row and returns true, or returns false when there are no more rows. */
+	using row_source_type		= std::function<bool(row_type&)>;
+
+// VALUES
+public:
+	static constexpr std::size_t default_block_size_c = 256;
+
+private:
+	/*! A uniform slice [begin,end) of the RPN program that is evaluated once per batch. */
+	struct Hoist {
+		std::size_t	begin;
+		std::size_t	end;
+	};
+
+// ATTRIBUTES
+private:
+	TokenList			program_m;
+	variable_list_type	varying_m;
+	std::vector<Hoist>	hoists_m;
+
+// OPERATIONS
+public:
+	BatchEvaluator(TokenList const& rpnExpression, variable_list_type const& varying);
+
+	[[nodiscard]] result_list_type	evaluate(row_list_type const& rows) const;
+
+	/*!	Evaluates the expression for each row pulled from 'next', yielding the results in row order.
+		Rows are read and evaluated 'blockSize' at a time, so memory is bounded by one block however long
+		the input.  Nothing is read before the first result is asked for, and nothing after the consumer
+		stops.  The BatchEvaluator and the source must outlive the generator.
+		*/
+	[[nodiscard]] Generator<Operand::pointer_type> stream(row_source_type next, std::size_t blockSize = default_block_size_c) const;
+
+	/*! Gets a row source that reads the rows [first,last). */
+	template <class InputIt>
+	[[nodiscard]] static row_source_type row_source(InputIt first, InputIt last) {
+		return [first, last](row_type& row) mutable {
+			if (first == last)
+				return false;
+			row = *first++;
+			return true;
+		};
+	}
+
+	/*!	Gets a row source that reads one row per line of 'in': numbers separated by blanks or commas.
+		Blank lines are skipped; a field that isn't a number throws std::runtime_error.
+		*/
+	[[nodiscard]] static row_source_type row_source(std::istream& in);
+
+	/*! Gets the row variables, in the order that their values appear in each row. */
+	[[nodiscard]] variable_list_type const& varying() const { return varying_m; }
+
+	/*! Gets the number of uniform subexpressions hoisted out of the per-row program. */
+	[[nodiscard]] std::size_t hoisted_count() const { return hoists_m.size(); }
+
+	/*! Gets the number of tokens executed for each row. */
+	[[nodiscard]] std::size_t row_program_size() const;
+
+private:
+	[[nodiscard]] TokenList _bind_uniforms() const;
+};
@@ -0,0 +1,50 @@
+#pragma once
+/*!	\file	cancellation_token.hpp
+	\brief	CancellationToken class.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the CancellationToken class, a shared flag that
+asks a running evaluation to stop.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <atomic>
+#include <memory>
+
+
+/*!	CancellationToken is a flag shared by its copies: one copy goes with an evaluation, which checks
+	it between operations and in its long loops, another stays with whoever may call cancel().
+	*/
+class CancellationToken {
+// ATTRIBUTES
+private:
+	std::shared_ptr<std::atomic<bool>>	cancelled_m = std::make_shared<std::atomic<bool>>(false);
+
+// OPERATIONS
+public:
+	/*! Asks the evaluations holding a copy of this token to stop; they fail with ErrorCode::Cancelled. */
+	void cancel() const { cancelled_m->store(true, std::memory_order_relaxed); }
+
+	[[nodiscard]] bool cancelled() const { return cancelled_m->load(std::memory_order_relaxed); }
+};
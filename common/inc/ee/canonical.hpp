@@ -0,0 +1,102 @@
+#pragma once
+/*!	\file	canonical.hpp
+	\brief	Expression canonicalization and structural hashing declarations.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declarations of the canonical form of a parsed expression.
+
+	struct Hash128
+	class Hasher128
+	struct CanonicalForm
+	token_tag()
+	exact_str()
+	canonicalize()
+	structural_hash()
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+
+/*! 128-bit hash value. */
+struct Hash128 {
+	std::uint64_t	high = 0;
+	std::uint64_t	low = 0;
+
+	[[nodiscard]] constexpr auto operator <=> (Hash128 const&) const = default;
+	[[nodiscard]] std::string str() const;
+};
+
+
+/*! Hash function object, so Hash128 can key the standard unordered containers. */
+template <> struct std::hash<Hash128> {
+	[[nodiscard]] std::size_t operator()(Hash128 const& h) const noexcept { return static_cast<std::size_t>(h.low ^ (h.high * 0x9E3779B97F4A7C15ull)); }
+};
+
+
+/*! Incremental 128-bit hasher: two independent 64-bit multiply-rotate lanes with a final avalanche. */
+class Hasher128 {
+	std::uint64_t	lane1_m = 0x243F6A8885A308D3ull;
+	std::uint64_t	lane2_m = 0x13198A2E03707344ull;
+	std::uint64_t	length_m = 0;
+public:
+	Hasher128& update(void const* data, std::size_t size);
+	Hasher128& update(std::string const& s) { update(std::uint64_t(s.size())); return update(s.data(), s.size()); }
+	Hasher128& update(std::uint64_t value) { return update(&value, sizeof(value)); }
+	Hasher128& update(Hash128 const& h) { update(h.high); return update(h.low); }
+	[[nodiscard]] Hash128 digest() const;
+};
+
+
+/*!	Gets a fixed tag naming the concrete type of a token.
+	Unlike typeid().name() the tag is the same under every compiler, so hashes and cache keys built from it are portable. */
+[[nodiscard]] std::string const& token_tag(Token const& token);
+
+
+/*!	Gets the exact text of an operand's value: every stored digit of a Real, every digit of an Integer.
+	Token::str() rounds a Real, so values that differ past its last printed digit would share a hash. */
+[[nodiscard]] std::string exact_str(Token const& operand);
+
+
+/*! Canonical form of a parsed expression. */
+struct CanonicalForm {
+	TokenList	rpn;	/// canonically ordered postfix expression.
+	Hash128		hash;	/// structural hash of the expression.
+};
+
+
+/*!	Canonicalizes a postfix expression.
+	The operands of commutative operations are put in a deterministic order so that
+	expressions that differ only in whitespace, keyword case, redundant parentheses or
+	commutative operand order share the same canonical form and hash. */
+[[nodiscard]] CanonicalForm canonicalize(TokenList const& rpnExpression);
+
+
+/*! Gets the structural hash of a postfix expression. */
+[[nodiscard]] inline Hash128 structural_hash(TokenList const& rpnExpression) { return canonicalize(rpnExpression).hash; }
@@ -0,0 +1,72 @@
+#pragma once
+/*!	\file	char_scan.hpp
+	\brief	Character run scanners.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the character run scanners used by the Tokenizer
+to skip whitespace, digit, and identifier runs.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <cstddef>
+
+
+/*	Character run scanners.
+	Each returns the first character in [first, last) that is not in its class, or last.
+	The classes are the Tokenizer's: space is ' ' and '\t' to '\r'; alnum is 0-9, A-Z, a-z.
+	Long runs are scanned 32 (AVX2) or 16 (SSE2) bytes at a time when the compiler targets
+	those instruction sets; otherwise, and for the tail of a run, one byte at a time.
+	*/
+[[nodiscard]] char const* space_run_end(char const* first, char const* last);
+[[nodiscard]] char const* digit_run_end(char const* first, char const* last);
+[[nodiscard]] char const* alnum_run_end(char const* first, char const* last);
+
+/*! Gets the instruction set the scanners use: "AVX2", "SSE2", or "scalar". */
+[[nodiscard]] char const* char_scan_instruction_set();
+
+
+
+// Scalar scanners: the fallback, and the reference for the vector versions.
+
+[[nodiscard]] constexpr bool is_space_char(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+[[nodiscard]] constexpr bool is_digit_char(char c) { return c >= '0' && c <= '9'; }
+[[nodiscard]] constexpr bool is_alnum_char(char c) { return is_digit_char(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+[[nodiscard]] constexpr char const* space_run_end_scalar(char const* first, char const* last) {
+	while (first != last && is_space_char(*first))
+		++first;
+	return first;
+}
+
+[[nodiscard]] constexpr char const* digit_run_end_scalar(char const* first, char const* last) {
+	while (first != last && is_digit_char(*first))
+		++first;
+	return first;
+}
+
+[[nodiscard]] constexpr char const* alnum_run_end_scalar(char const* first, char const* last) {
+	while (first != last && is_alnum_char(*first))
+		++first;
+	return first;
+}
@@ -0,0 +1,83 @@
+#pragma once
+/*!	\file	cost_estimator.hpp
+	\brief	CostEstimator class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the CostEstimator class, a static estimate of
+the work needed to evaluate a postfix expression.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/operand.hpp>
+#include <cstddef>
+#include <functional>
+
+
+/*! The estimated cost of evaluating an expression. */
+struct CostEstimate {
+	double		units = 0.0;		/// work, in limb multiplications: roughly 0.3 to 1 ns each.
+	double		digits = 1.0;		/// decimal digits in the integer part of the result, at most.
+	std::size_t	steps = 0;			/// operations.
+	bool		bounded = true;		/// false if it depends on unknown values, which are assumed to be unknown_digits_c digits long.
+
+	[[nodiscard]] bool operator < (CostEstimate const& rhs) const { return units < rhs.units; }
+};
+
+
+
+/*!	CostEstimator estimates the cost of a postfix expression without evaluating it.
+
+	It runs the expression over bounds instead of values: the kind of each intermediate value and
+	the number of digits it may have, and its value where a literal makes it known.  Each operation
+	is charged by its kind, the precision of reals and the size of its operands: the Factorial and
+	integer Power loops by the digits they produce, a transcendental function by its measured cost
+	at the real precision.  The estimate is meant for ordering and splitting work; it is not a limit.
+	*/
+class CostEstimator {
+// TYPES
+public:
+	/*! Gets the value a variable will have, or nullptr if it isn't known. */
+	using lookup_type = std::function<Operand::pointer_type(Token const& variable)>;
+
+// VALUES
+public:
+	static constexpr double unknown_digits_c = 18.0;	/// the assumed size of an unknown value.
+	static constexpr double max_units_c = 1e300;		/// estimates saturate here.
+
+// ATTRIBUTES
+private:
+	double		realDigits_m;
+	lookup_type	lookup_m;
+
+// OPERATIONS
+public:
+	/*!	@param realDigits [in] the precision of reals, in decimal digits; 0 for the precision of Real.
+		@param lookup [in] supplies known variable values; by default a variable's current value is used.
+		*/
+	explicit CostEstimator(unsigned realDigits = 0, lookup_type lookup = {});
+
+	[[nodiscard]] CostEstimate estimate(TokenList const& rpnExpression) const;
+
+	[[nodiscard]] double real_digits() const { return realDigits_m; }
+};
@@ -0,0 +1,111 @@
+#pragma once
+/*!	\file	error.hpp
+	\brief	Error codes and the Expected result type.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declarations of ErrorCode, Error, and Expected<T>, used by the
+non-throwing try_ interfaces of the tokenizer, parser, and
+evaluators.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <variant>
+
+
+/*! Errors reported by the try_ interfaces; the throwing interfaces throw the matching exception. */
+enum class ErrorCode : std::uint8_t {
+	None = 0,
+
+	// Tokenizer
+	BadCharacter,
+	BadNumber,
+	FunctionWithoutParenthesis,
+	FactorialWithoutOperand,
+
+	// Parser
+	UnmatchedRightParenthesis,
+	MissingRightParenthesis,
+
+	// RPNEvaluator
+	InsufficientOperands,
+	TooManyOperands,
+	UnsupportedOperand,
+	VariableNotInitialized,
+	AssignmentToNonVariable,
+	EvaluationFailed,			/// the arithmetic library failed (e.g. integer division by zero).
+	StepLimitExceeded,			/// the evaluation was stopped by its EvaluationLimits: too many steps,
+	DigitLimitExceeded,			/// an integer with too many digits,
+	TimeLimitExceeded,			/// or past its time limit.
+	Cancelled,					/// the evaluation's CancellationToken was cancelled.
+
+	// SnapshotEvaluator
+	AssignmentRejected			/// the expression assigns a variable, which a snapshot evaluation may not do.
+};
+
+
+/*! Gets the message of the exception the throwing interfaces raise for an error code. */
+[[nodiscard]] char const* message(ErrorCode code);
+
+/*! Tests if an evaluation was stopped by its EvaluationLimits, rather than failing. */
+[[nodiscard]] constexpr bool is_limit(ErrorCode code) {
+	return code == ErrorCode::StepLimitExceeded || code == ErrorCode::DigitLimitExceeded || code == ErrorCode::TimeLimitExceeded;
+}
+
+
+
+/*! An error and where it occurred. */
+struct Error {
+	ErrorCode	code = ErrorCode::None;
+	std::size_t	offset = 0;		/// character offset, or token index for token list input; see each try_ function.
+
+	[[nodiscard]] constexpr explicit operator bool() const { return code != ErrorCode::None; }
+	[[nodiscard]] char const* message() const { return ::message(code); }
+};
+
+
+
+/*! Either a value or an Error (a minimal std::expected). */
+template <typename T>
+class Expected {
+	std::variant<T, Error>	result_m;
+public:
+	Expected(T value) : result_m(std::in_place_index<0>, std::move(value)) { }
+	Expected(Error error) : result_m(std::in_place_index<1>, error) { assert(error && "Expected needs a real error"); }
+
+	[[nodiscard]] bool has_value() const { return result_m.index() == 0; }
+	[[nodiscard]] explicit operator bool() const { return has_value(); }
+
+	[[nodiscard]] T& value() { assert(has_value()); return *std::get_if<0>(&result_m); }
+	[[nodiscard]] T const& value() const { assert(has_value()); return *std::get_if<0>(&result_m); }
+	[[nodiscard]] T& operator * () { return value(); }
+	[[nodiscard]] T const& operator * () const { return value(); }
+	[[nodiscard]] T* operator -> () { return &value(); }
+	[[nodiscard]] T const* operator -> () const { return &value(); }
+
+	[[nodiscard]] Error error() const { return has_value() ? Error{} : *std::get_if<1>(&result_m); }
+};
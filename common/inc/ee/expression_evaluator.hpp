@@ -9,6 +9,16 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added compile_batch()
+	Added use_function_cache()
+	Added use_result_cache()
+	Added evaluate_once()
+	Added evaluate_stream()
+	Added try_evaluate()
+	Added set_limits()
+	Added evaluate_async()
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -31,7 +41,15 @@ the program(s) have been supplied.
 #include <ee/tokenizer.hpp>
 #include <ee/parser.hpp>
 #include <ee/RPNEvaluator.hpp>
+#include <ee/batch_evaluator.hpp>
 #include <ee/function.hpp>
+#include <ee/result_cache.hpp>
+#include <ee/cancellation_token.hpp>
+#include <ee/thread_pool.hpp>
+#include <future>
+#include <iosfwd>
+#include <memory>
+#include <vector>
 
 
 class ExpressionEvaluator {
@@ -42,6 +60,39 @@ private:
 	Tokenizer		tokenizer_m;
 	Parser			parser_m;
 	RPNEvaluator	rpn_m;
+	ResultCache*	resultCache_m = nullptr;
+
+	struct AsyncQueue;
+	std::unique_ptr<AsyncQueue>	async_m;		/// evaluate_async() calls not yet finished.
 public:
+	ExpressionEvaluator();
+	/*! Waits for the evaluate_async() calls still pending. */
+	~ExpressionEvaluator();
+
 	[[nodiscard]] result_type evaluate(expression_type const& expr);
+	[[nodiscard]] Expected<result_type> try_evaluate(expression_type const& expr);
+	[[nodiscard]] result_type evaluate_once(expression_type const& expr);
+	[[nodiscard]] result_type evaluate_stream(std::istream& in);
+	[[nodiscard]] BatchEvaluator compile_batch(expression_type const& expr, std::vector<expression_type> const& rowVariables);
+
+	/*! Memoizes transcendental function calls in 'cache' (e.g. FunctionCache::thread_local_cache()); nullptr disables. */
+	void use_function_cache(FunctionCache* cache) { rpn_m.use_function_cache(cache); }
+
+	/*! Reuses results of repeated evaluations from 'cache'; nullptr (the default) disables. */
+	void use_result_cache(ResultCache* cache) { resultCache_m = cache; }
+
+	/*! Limits each evaluation's steps, integer digits and time (see EvaluationLimits). */
+	void set_limits(EvaluationLimits const& limits) { rpn_m.set_limits(limits); }
+
+	/*!	As try_evaluate(), on a thread of 'pool', returning at once.
+		The calls on one evaluator run one at a time, in the order they were made, so each sees the
+		variables the earlier ones set; the evaluator must not be used otherwise until they finish.
+		An evaluation stops with ErrorCode::Cancelled if 'cancel' is cancelled before or while it runs.
+		A variable result is replaced by its value, so later evaluations can't change it.
+		*/
+	[[nodiscard]] std::future<Expected<result_type>> evaluate_async(expression_type expr,
+		CancellationToken cancel = CancellationToken(), ThreadPool& pool = ThreadPool::shared());
+
+private:
+	void _run_async(ThreadPool& pool);
 };
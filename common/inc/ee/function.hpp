@@ -37,6 +37,9 @@ Includes the subclasses:
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added number_of_args() overrides
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -78,6 +81,7 @@ class Function : public Operation { };
 		/*! One argument function token base class. */
 		class OneArgFunction : public Function {
 		public:
+			[[nodiscard]] unsigned number_of_args() const override { return 1; }
 		};
 
 				/*! Absolute value function token. */
@@ -129,6 +133,7 @@ class Function : public Operation { };
 		/*!	Two argument function token base class. */
 		class TwoArgFunction : public Function {
 		public:
+			[[nodiscard]] unsigned number_of_args() const override { return 2; }
 		};
 
 				/*! 2 parameter arc tangent function token.
@@ -148,4 +153,5 @@ class Function : public Operation { };
 		/*!	Three argument function token base class. */
 		class ThreeArgFunction : public Function {
 		public:
+			[[nodiscard]] unsigned number_of_args() const override { return 3; }
 		};
@@ -0,0 +1,115 @@
+#pragma once
+/*!	\file	function_cache.hpp
+	\brief	FunctionCache class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the FunctionCache class, a bounded memo cache
+for pure real-valued function calls.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/real.hpp>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+/*!	FunctionCache memoizes expensive pure function calls (sin, ln, exp, sqrt, arctan2, ...)
+	keyed by the function kind and the exact digits of the arguments.
+
+	The cache is bounded by a byte budget and evicts the least recently used entry.
+	It is not synchronized: give each thread its own cache, e.g. thread_local_cache().
+	*/
+class FunctionCache {
+	// Block copying
+	FunctionCache(FunctionCache const&) = delete;
+	FunctionCache& operator = (FunctionCache const&) = delete;
+
+// TYPES
+public:
+	using value_type = Real::value_type;
+	using key_type = std::string;
+
+	/*! Cache usage counters. */
+	struct Statistics {
+		std::uint64_t	hits = 0;
+		std::uint64_t	misses = 0;
+		std::uint64_t	evictions = 0;
+		std::size_t		entries = 0;
+		std::size_t		bytes = 0;
+
+		[[nodiscard]] double hit_rate() const { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+	};
+
+private:
+	struct Entry {
+		key_type	key;
+		value_type	value;
+	};
+	using lru_type = std::list<Entry>;
+	using index_type = std::unordered_map<std::string_view, lru_type::iterator>;
+
+// VALUES
+public:
+	static constexpr std::size_t default_budget_c = 16 * 1024 * 1024;
+
+// ATTRIBUTES
+private:
+	lru_type		lru_m;			/// most recently used first.
+	index_type		index_m;
+	std::size_t		budget_m;
+	Statistics		stats_m;
+
+// OPERATIONS
+public:
+	explicit FunctionCache(std::size_t byteBudget = default_budget_c) : budget_m(byteBudget) { }
+
+	[[nodiscard]] static FunctionCache& thread_local_cache();
+	[[nodiscard]] static key_type make_key(Token const& function, value_type const& arg);
+	[[nodiscard]] static key_type make_key(Token const& function, value_type const& arg1, value_type const& arg2);
+
+	[[nodiscard]] value_type const* find(key_type const& key);
+	void insert(key_type key, value_type const& value);
+	void clear();
+
+	/*! Gets the cached result of 'compute', calling it on a miss. */
+	template <typename COMPUTE>
+	[[nodiscard]] value_type memoize(key_type const& key, COMPUTE compute) {
+		if (auto found = find(key))
+			return *found;
+		value_type result = compute();
+		insert(key, result);
+		return result;
+	}
+
+	[[nodiscard]] Statistics const& statistics() const { return stats_m; }
+	[[nodiscard]] std::size_t budget() const { return budget_m; }
+	void set_budget(std::size_t byteBudget);
+
+private:
+	void _evict_to_budget();
+	[[nodiscard]] static std::size_t _entry_bytes(Entry const& entry) { return sizeof(Entry) + entry.key.capacity() + 4 * sizeof(void*); }
+};
@@ -0,0 +1,143 @@
+#pragma once
+/*!	\file	generator.hpp
+	\brief	Generator class template.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the Generator class template, a C++20 coroutine
+that yields a sequence of values on demand.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+
+/*!	Generator<T> is the return type of a coroutine that produces T values with co_yield.
+
+	Nothing runs until the first value is asked for, and the coroutine is suspended after each
+	value until the next one is asked for, so values are produced one at a time.  Destroying the
+	generator destroys the suspended coroutine and its locals; a consumer that stops early pays
+	for nothing it didn't read.  An exception thrown by the coroutine is rethrown to the consumer.
+
+	Generator is an input range: it can be iterated once, with a range-based for.
+	*/
+template <class T>
+class Generator {
+// TYPES
+public:
+	class promise_type {
+	// ATTRIBUTES
+	private:
+		T const*			value_m = nullptr;		/// the value last yielded, in the coroutine frame.
+		std::exception_ptr	exception_m;
+
+	// OPERATIONS
+	public:
+		[[nodiscard]] Generator get_return_object() { return Generator(handle_type::from_promise(*this)); }
+		[[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+		[[nodiscard]] std::suspend_always final_suspend() const noexcept { return {}; }
+		void return_void() const noexcept { }
+		void unhandled_exception() { exception_m = std::current_exception(); }
+
+		/*! The value lives in the coroutine until it resumes, so only its address is kept. */
+		[[nodiscard]] std::suspend_always yield_value(T const& value) noexcept { value_m = std::addressof(value); return {}; }
+
+		/*! Generators yield, they don't await. */
+		template <class U> std::suspend_never await_transform(U&&) = delete;
+
+		[[nodiscard]] T const& value() const { return *value_m; }
+		void rethrow_if_failed() const { if (exception_m) std::rethrow_exception(exception_m); }
+	};
+	using handle_type = std::coroutine_handle<promise_type>;
+
+	class iterator {
+	// TYPES
+	public:
+		using iterator_category	= std::input_iterator_tag;
+		using difference_type	= std::ptrdiff_t;
+		using value_type		= T;
+
+	// ATTRIBUTES
+	private:
+		handle_type	coroutine_m;
+
+	// OPERATIONS
+	public:
+		iterator() = default;
+		explicit iterator(handle_type coroutine) : coroutine_m(coroutine) { }
+
+		[[nodiscard]] T const& operator * () const { return coroutine_m.promise().value(); }
+		[[nodiscard]] T const* operator -> () const { return std::addressof(coroutine_m.promise().value()); }
+
+		iterator& operator ++ () {
+			coroutine_m.resume();
+			coroutine_m.promise().rethrow_if_failed();
+			return *this;
+		}
+		void operator ++ (int) { ++*this; }
+
+		[[nodiscard]] friend bool operator == (iterator const& it, std::default_sentinel_t) { return !it.coroutine_m || it.coroutine_m.done(); }
+	};
+
+// ATTRIBUTES
+private:
+	handle_type	coroutine_m;
+
+// OPERATIONS
+public:
+	Generator(Generator&& other) noexcept : coroutine_m(std::exchange(other.coroutine_m, nullptr)) { }
+	Generator& operator = (Generator&& other) noexcept {
+		if (this != &other) {
+			if (coroutine_m)
+				coroutine_m.destroy();
+			coroutine_m = std::exchange(other.coroutine_m, nullptr);
+		}
+		return *this;
+	}
+	~Generator() {
+		if (coroutine_m)
+			coroutine_m.destroy();
+	}
+
+	/*! Runs the coroutine to its first value.  Call once. */
+	[[nodiscard]] iterator begin() {
+		if (coroutine_m) {
+			coroutine_m.resume();
+			coroutine_m.promise().rethrow_if_failed();
+		}
+		return iterator(coroutine_m);
+	}
+	[[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+private:
+	explicit Generator(handle_type coroutine) : coroutine_m(coroutine) { }
+
+// Block copying
+private:
+	Generator(Generator const&) = delete;
+	Generator& operator = (Generator const&) = delete;
+};
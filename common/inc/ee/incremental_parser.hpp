@@ -0,0 +1,119 @@
+#pragma once
+/*!	\file	incremental_parser.hpp
+	\brief	IncrementalParser class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the IncrementalParser class, which re-tokenizes
+and re-parses only the part of an expression changed by an edit.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/error.hpp>
+#include <ee/parser.hpp>
+#include <ee/tokenizer.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+/*!	IncrementalParser keeps an expression, its tokens and its postfix form up to date as the
+	expression is edited, e.g. on every keystroke in an interactive editor.
+
+	An edit is re-tokenized from the first token it touches until the tokenizer starts a token
+	at the same place, and in the same state, as an old token after the edit; the old tokens
+	from there on are kept, moved by the change in length.  The parser is re-run from the last
+	sync point at or before the first changed token, keeping the postfix output before it.
+	Sync points save the parser state every sync_interval_c tokens.
+	*/
+class IncrementalParser {
+	IncrementalParser(IncrementalParser const&) = delete;
+	IncrementalParser& operator = (IncrementalParser const&) = delete;
+
+// TYPES
+public:
+	using string_type = Tokenizer::string_type;
+	using State = Tokenizer::Cursor::State;
+
+	/*! A token and where it is in the text. */
+	struct Lexeme {
+		Token::pointer_type	token;
+		std::size_t			offset = 0;
+		std::size_t			length = 0;
+		State				state = State::ExpectOperand;	/// lexer state before the token.
+
+		[[nodiscard]] std::size_t end() const { return offset + length; }
+	};
+
+	/*! What an edit changed: tokens [first, first + removed) were replaced by [first, first + inserted). */
+	struct Update {
+		std::size_t	first = 0;
+		std::size_t	removed = 0;
+		std::size_t	inserted = 0;
+		std::size_t	reparsedFrom = 0;	/// token index the parser restarted at.
+		Error		error;				/// the first error in the expression, if any (character offset).
+	};
+
+private:
+	/*! Parser state before token 'token', with 'output' postfix tokens so far. */
+	struct SyncPoint {
+		std::size_t			token = 0;
+		std::size_t			output = 0;
+		Parser::state_type	state;
+	};
+
+// VALUES
+public:
+	static constexpr std::size_t sync_interval_c = 8;
+
+// ATTRIBUTES
+private:
+	Tokenizer&				tokenizer_m;
+	Parser					parser_m;
+	string_type				text_m;
+	std::vector<Lexeme>		lexemes_m;
+	State					endState_m = State::ExpectOperand;	/// lexer state after the last token.
+	std::vector<SyncPoint>	syncPoints_m{ SyncPoint{} };	/// by token; the first is the start.
+	TokenList				postfix_m;
+	Error					lexError_m;
+	Error					error_m;
+
+// OPERATIONS
+public:
+	explicit IncrementalParser(Tokenizer& tokenizer) : tokenizer_m(tokenizer) { }
+
+	Update assign(string_type text);
+	Update edit(std::size_t offset, std::size_t removedLength, std::string_view inserted);
+
+	[[nodiscard]] string_type const& text() const { return text_m; }
+	[[nodiscard]] std::vector<Lexeme> const& lexemes() const { return lexemes_m; }
+	[[nodiscard]] TokenList infix() const;
+
+	/*! Gets the postfix expression; only complete if there is no error(). */
+	[[nodiscard]] TokenList const& postfix() const { return postfix_m; }
+	[[nodiscard]] Error error() const { return error_m; }
+
+private:
+	void _lex(std::size_t first, std::size_t start, std::size_t editBegin, std::size_t editEnd, std::ptrdiff_t delta, Update& update);
+	void _parse(std::size_t firstChanged, Update& update);
+};
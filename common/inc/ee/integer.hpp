@@ -12,6 +12,9 @@ Declarations of the Integer class derived from Operand.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	value() returns a reference.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -66,6 +69,6 @@ public:
 	Integer( value_type value = 0 )
 		: value_( value ) { }
 
-	[[nodiscard]]	value_type	value() const { return value_; }
+	[[nodiscard]]	value_type const& value() const { return value_; }
 	[[nodiscard]]	string_type	str() const override;
 };
\ No newline at end of file
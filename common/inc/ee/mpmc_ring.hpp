@@ -0,0 +1,137 @@
+#pragma once
+/*!	\file	mpmc_ring.hpp
+	\brief	SpscQueue class template.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the MpmcRing class, a fixed-capacity lock-free
+multi-producer/multi-consumer ring that can live in shared memory.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+/*!	MpmcRing is a bounded lock-free queue for any number of producers and consumers (D. Vyukov's
+	bounded MPMC queue).
+
+	Every cell has a sequence number that says whether it is free for the producer of a given
+	position or full for its consumer, so a push or pop is one compare-and-swap on the shared
+	index plus one release store on the cell.  The ring holds no pointers and allocates nothing,
+	so it can be placed in memory shared between processes, provided std::atomic<std::uint64_t>
+	is lock-free; it must be initialized by exactly one party before use.
+	*/
+template <typename T, std::size_t CAPACITY>
+class MpmcRing {
+	static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "MpmcRing capacity must be a power of two");
+	static_assert(std::is_trivially_copyable_v<T>, "MpmcRing items are copied as bytes");
+	static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "MpmcRing needs lock-free 64-bit atomics");
+
+// TYPES
+public:
+	using value_type = T;
+
+private:
+	struct Cell {
+		std::atomic<std::uint64_t>	sequence;
+		T							value;
+	};
+
+// VALUES
+public:
+	static constexpr std::size_t capacity_c = CAPACITY;
+
+private:
+	static constexpr std::size_t cache_line_c = 64;
+	static constexpr std::uint64_t mask_c = CAPACITY - 1;
+
+// ATTRIBUTES
+private:
+	alignas(cache_line_c) std::atomic<std::uint64_t>	tail_m;		/// next position to push.
+	alignas(cache_line_c) std::atomic<std::uint64_t>	head_m;		/// next position to pop.
+	alignas(cache_line_c) Cell							cells_m[CAPACITY];
+
+// OPERATIONS
+public:
+	MpmcRing() { init(); }
+
+	/*! Empties the ring; for a ring placed in raw (e.g. shared) memory, which no constructor has run on. */
+	void init() {
+		for (std::size_t i = 0; i < CAPACITY; ++i)
+			cells_m[i].sequence.store(i, std::memory_order_relaxed);
+		head_m.store(0, std::memory_order_relaxed);
+		tail_m.store(0, std::memory_order_release);
+	}
+
+	/*! Adds an item. @return false if the ring is full. */
+	[[nodiscard]] bool try_push(T const& value) {
+		auto position = tail_m.load(std::memory_order_relaxed);
+		for (;;) {
+			auto& cell = cells_m[position & mask_c];
+			auto const sequence = cell.sequence.load(std::memory_order_acquire);
+			auto const lag = std::int64_t(sequence - position);
+			if (lag == 0) {
+				if (tail_m.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					cell.value = value;
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (lag < 0)
+				return false;		// the consumer of the previous lap hasn't emptied the cell
+			else
+				position = tail_m.load(std::memory_order_relaxed);
+		}
+	}
+
+	/*! Removes the oldest item. @return false if the ring is empty. */
+	[[nodiscard]] bool try_pop(T& value) {
+		auto position = head_m.load(std::memory_order_relaxed);
+		for (;;) {
+			auto& cell = cells_m[position & mask_c];
+			auto const sequence = cell.sequence.load(std::memory_order_acquire);
+			auto const lag = std::int64_t(sequence - (position + 1));
+			if (lag == 0) {
+				if (head_m.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					value = cell.value;
+					cell.sequence.store(position + CAPACITY, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (lag < 0)
+				return false;
+			else
+				position = head_m.load(std::memory_order_relaxed);
+		}
+	}
+
+	/*! Gets the number of items, approximately while other threads are using the ring. */
+	[[nodiscard]] std::size_t size_approx() const {
+		auto const tail = tail_m.load(std::memory_order_relaxed);
+		auto const head = head_m.load(std::memory_order_relaxed);
+		return tail > head ? std::size_t(tail - head) : 0;
+	}
+};
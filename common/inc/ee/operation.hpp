@@ -17,6 +17,9 @@ supporting utilities.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added number_of_args()
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -58,6 +61,7 @@ the program(s) have been supplied.
 class Operation : public Token {
 public:
 	DEF_POINTER_TYPE(Operation)
+	[[nodiscard]] virtual unsigned number_of_args() const = 0;
 };
 
 
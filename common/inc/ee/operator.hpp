@@ -46,6 +46,10 @@ supporting utilities.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added number_of_args() overrides
+	Added get_precedence() and DEF_PRECEDENCE
+
 Version 2021.10.02
 	C++ 20 validated
 	Converted 'enum' to 'enum class'
@@ -99,14 +103,22 @@ enum class Precedence { MIN = 0,
 
 
 
+/*! Defines the precedence of an operator class. */
+#define DEF_PRECEDENCE(_PREC) public: [[nodiscard]] Precedence get_precedence() const override { return Precedence::_PREC; }
+
+
+
 /*! Operator token base class. */
 class Operator : public Operation {
 public:
 	DEF_POINTER_TYPE(Operator)
+	[[nodiscard]] virtual Precedence get_precedence() const = 0;
 };
 
 		/*! Binary operator token base class. */
 		class BinaryOperator : public Operator {
+		public:
+			[[nodiscard]] unsigned number_of_args() const override { return 2; }
 		};
 
 				/*! Right-associative operator base class. */
@@ -114,10 +126,12 @@ public:
 
 						/*! Power token. */
 						class Power : public RAssocOperator {
+							DEF_PRECEDENCE(POWER)
 						};
 
 						/*! Assignment token. */
 						class Assignment : public RAssocOperator {
+							DEF_PRECEDENCE(ASSIGNMENT)
 						};
 
 
@@ -126,70 +140,87 @@ public:
 
 						/*! Addition token. */
 						class Addition : public LAssocOperator {
+							DEF_PRECEDENCE(ADDITIVE)
 						};
 
 						/*! And token. */
 						class And : public LAssocOperator {
+							DEF_PRECEDENCE(LOGAND)
 						};
 
 						/*! Division token. */
 						class Division : public LAssocOperator {
+							DEF_PRECEDENCE(MULTIPLICATIVE)
 						};
 
 						/*! Equality token. */
 						class Equality : public LAssocOperator {
+							DEF_PRECEDENCE(EQUALITY)
 						};
 
 						/*! Greater than token. */
 						class Greater : public LAssocOperator {
+							DEF_PRECEDENCE(RELATIONAL)
 						};
 
 						/*! Greater than or equal to token. */
 						class GreaterEqual : public LAssocOperator {
+							DEF_PRECEDENCE(RELATIONAL)
 						};
 
 						/*! Inequality operator token. */
 						class Inequality : public LAssocOperator {
+							DEF_PRECEDENCE(EQUALITY)
 						};
 
 						/*! Less than operator token. */
 						class Less : public LAssocOperator {
+							DEF_PRECEDENCE(RELATIONAL)
 						};
 
 						/*! Less than equal-to operator token. */
 						class LessEqual : public LAssocOperator {
+							DEF_PRECEDENCE(RELATIONAL)
 						};
 
 						/*! Multiplication operator token. */
 						class Multiplication : public LAssocOperator {
+							DEF_PRECEDENCE(MULTIPLICATIVE)
 						};
 
 						/*! Modulus operator token. */
 						class Modulus : public LAssocOperator {
+							DEF_PRECEDENCE(MULTIPLICATIVE)
 						};
 
 						/*! Nand operator token. */
 						class Nand : public LAssocOperator {
+							DEF_PRECEDENCE(LOGAND)
 						};
 
 						/*! Nor operator token. */
 						class Nor : public LAssocOperator {
+							DEF_PRECEDENCE(LOGOR)
 						};
 
 						/*! Or operator token. */
 						class Or : public LAssocOperator {
+							DEF_PRECEDENCE(LOGOR)
 						};
 
 						/*! Subtraction operator token. */
 						class Subtraction : public LAssocOperator {
+							DEF_PRECEDENCE(ADDITIVE)
 						};
 
 						/*! XOR operator token. */
 						class Xor : public LAssocOperator {
+							DEF_PRECEDENCE(LOGXOR)
 						};
 
 						/*! XNOR operator token. */
 						class Xnor : public LAssocOperator {
+							DEF_PRECEDENCE(LOGXOR)
 						};
 
 
@@ -198,18 +229,23 @@ public:
 
 				/*! Unary operator token base class. */
 				class UnaryOperator : public NonAssociative {
+				public:
+					[[nodiscard]] unsigned number_of_args() const override { return 1; }
 				};
 
 						/*! Identity operator token. */
 						class Identity : public UnaryOperator {
+							DEF_PRECEDENCE(UNARY)
 						};
 
 						/*! Negation operator token. */
 						class Negation : public UnaryOperator {
+							DEF_PRECEDENCE(UNARY)
 						};
 
 						/*! Not operator token. */
 						class Not : public UnaryOperator {
+							DEF_PRECEDENCE(UNARY)
 						};
 
 				/*! Postfix Operator token base class. */
@@ -217,4 +253,5 @@ public:
 
 						/*! Factorial token base class. */
 						class Factorial : public PostfixOperator {
+							DEF_PRECEDENCE(POSTFIX)
 						};
@@ -10,6 +10,12 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added incremental push()/finish() interface.
+	Added XParser.
+	Added try_parse(), try_push(), try_finish().
+	Added state() and restore().
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -36,12 +42,49 @@ or in accordance with the terms and conditions
 stipulated in the agreement/contract under which
 the program(s) have been supplied.
 =============================================================*/
+#include <ee/error.hpp>
 #include <ee/token.hpp>
+#include <stack>
+#include <stdexcept>
+#include <utility>
+
+/*!	Parser converts infix token sequences to postfix (shunting-yard).
 
+	parse() converts a whole list.  push()/finish() convert one token at a time,
+	sending each postfix token to 'output' as soon as it is known.
+	*/
 class Parser {
 	Parser(Parser const&) = delete;
 	Parser& operator = (Parser const&) = delete;
+
+	std::stack<Token::pointer_type>	opStack_m;
 public:
+	/*! Syntax error exception class. */
+	class XParser : public std::runtime_error {
+		std::size_t	location_m;
+	public:
+		static constexpr std::size_t unknown_location_c = std::size_t(-1);
+
+		explicit XParser(char const* msg, std::size_t location = unknown_location_c) : std::runtime_error(msg), location_m(location) { }
+
+		/*! Gets the offset of the offending token in the expression string, or unknown_location_c. */
+		[[nodiscard]] constexpr std::size_t location() const { return location_m; }
+	};
+
 	Parser() = default;
 	[[nodiscard]] TokenList parse(TokenList const& infixTokens);
+
+	void push(Token::pointer_type const& token, TokenSink& output);
+	void finish(TokenSink& output);
+
+	[[nodiscard]] Expected<TokenList> try_parse(TokenList const& infixTokens);
+	[[nodiscard]] ErrorCode try_push(Token::pointer_type const& token, TokenSink& output);
+	[[nodiscard]] ErrorCode try_finish(TokenSink& output);
+	void reset() { opStack_m = {}; }
+
+	/*! Parser state between two tokens: the pending operators.  The output so far is final,
+		so parsing can resume from a saved state() once the output is cut back to where it was. */
+	using state_type = std::stack<Token::pointer_type>;
+	[[nodiscard]] state_type const& state() const { return opStack_m; }
+	void restore(state_type state) { opStack_m = std::move(state); }
 };
@@ -0,0 +1,121 @@
+#pragma once
+/*!	\file	pipeline_evaluator.hpp
+	\brief	PipelineEvaluator class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the PipelineEvaluator class, which reads,
+tokenizes, parses and evaluates a stream of expressions on
+separate threads.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/error.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/spsc_queue.hpp>
+#include <ee/tokenizer.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+/*!	PipelineEvaluator evaluates a stream of expressions, one per line, with the reader, Tokenizer,
+	Parser and RPNEvaluator each on its own thread, connected by bounded SpscQueues.
+
+	Lines that fail to tokenize or parse leave the pipeline early, so the outcomes reach the
+	caller's thread out of order; they are re-sequenced to input order before they are written.
+	Variables persist across lines and runs: a line sees every assignment made by earlier lines.
+	*/
+class PipelineEvaluator {
+	// Block copying
+	PipelineEvaluator(PipelineEvaluator const&) = delete;
+	PipelineEvaluator& operator = (PipelineEvaluator const&) = delete;
+
+// TYPES
+public:
+	using clock_type = std::chrono::steady_clock;
+
+	/*! The outcome of a line. */
+	struct Outcome {
+		std::uint64_t				line = 0;		/// 0-based line number.
+		Operand::pointer_type		value;			/// nullptr for an empty line or on an error; a variable's value, unless uninitialized.
+		Error						error;			/// character offset in the line.
+		clock_type::duration		latency{};		/// from read to evaluated.
+	};
+
+	/*! Gets the next line; returns false at the end of the input.  Called on the reader thread. */
+	using reader_type = std::function<bool(std::string& line)>;
+
+	/*! Receives the outcomes in input order, on the thread that called run(). */
+	using writer_type = std::function<void(Outcome const& outcome)>;
+
+	/*! Queue usage, to find the bottleneck: the queues into a slow stage are full, those out of it empty. */
+	struct QueueReport {
+		char const*		name;
+		QueueStatistics	statistics;
+	};
+
+	struct Statistics {
+		std::uint64_t				lines = 0;
+		std::uint64_t				errors = 0;
+		double						seconds = 0.0;
+		std::vector<QueueReport>	queues;
+
+		[[nodiscard]] double lines_per_second() const { return seconds > 0.0 ? double(lines) / seconds : 0.0; }
+	};
+
+private:
+	struct Item {
+		std::uint64_t				line = 0;
+		clock_type::time_point		start;
+		std::string					text;
+		TokenList					tokens;
+		std::vector<std::size_t>	offsets;		/// character offset of each token.
+		TokenList					postfix;
+	};
+
+// VALUES
+public:
+	static constexpr std::size_t default_queue_capacity_c = 1024;
+
+// ATTRIBUTES
+private:
+	Tokenizer		tokenizer_m;
+	Parser			parser_m;
+	RPNEvaluator	rpn_m;
+	std::size_t		queueCapacity_m;
+
+// OPERATIONS
+public:
+	explicit PipelineEvaluator(std::size_t queueCapacity = default_queue_capacity_c) : queueCapacity_m(queueCapacity) { }
+
+	Statistics run(reader_type const& read, writer_type const& write);
+
+private:
+	void _tokenize(SpscQueue<Item>& in, SpscQueue<Item>& out, SpscQueue<Outcome>& done);
+	void _parse(SpscQueue<Item>& in, SpscQueue<Item>& out, SpscQueue<Outcome>& done);
+	void _evaluate(SpscQueue<Item>& in, SpscQueue<Outcome>& done);
+};
@@ -0,0 +1,77 @@
+#pragma once
+/*!	\file	pratt_parser.hpp
+	\brief	PrattParser class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the PrattParser class, a precedence-climbing
+parser that builds an Ast.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/ast.hpp>
+#include <ee/operator.hpp>
+#include <ee/parser.hpp>
+#include <ee/tokenizer.hpp>
+
+
+/*!	PrattParser parses an expression string into an Ast, pulling tokens from a Tokenizer.
+
+	It uses the operator precedence and associativity of Parser (Operator::get_precedence()),
+	so Ast::to_rpn() matches Parser::parse() for every expression Parser accepts.
+	*/
+class PrattParser {
+	PrattParser(PrattParser const&) = delete;
+	PrattParser& operator = (PrattParser const&) = delete;
+
+public:
+	using string_type = Tokenizer::string_type;
+
+	using XParser = Parser::XParser;
+
+private:
+	/*! A parsed subexpression; the span includes any enclosing parentheses. */
+	struct Subexpression {
+		Ast::index_type	node;
+		Ast::Span		span;
+	};
+
+	Tokenizer&			tokenizer_m;
+	Tokenizer::Cursor*	cursor_m = nullptr;
+	Token::pointer_type	current_m;			/// lookahead token; nullptr at the end.
+	Ast::Span			currentSpan_m;
+	Ast*				ast_m = nullptr;
+
+public:
+	explicit PrattParser(Tokenizer& tokenizer) : tokenizer_m(tokenizer) { }
+
+	[[nodiscard]] Ast parse(string_type const& expression);
+
+private:
+	void _advance();
+	void _expect_right_parenthesis();
+	[[nodiscard]] Subexpression _parse_expression(Precedence minPrecedence);
+	[[nodiscard]] Subexpression _parse_prefix();
+	[[nodiscard]] Subexpression _parse_call(Token::pointer_type const& function, Ast::Span nameSpan);
+	[[nodiscard]] static Ast::Span _join(Ast::Span first, Ast::Span last) { return Ast::Span{ first.offset, last.end() - first.offset }; }
+};
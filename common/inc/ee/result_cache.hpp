@@ -0,0 +1,122 @@
+#pragma once
+/*!	\file	result_cache.hpp
+	\brief	ResultCache class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the ResultCache class, an exact cache of whole
+expression evaluations.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/canonical.hpp>
+#include <ee/operand.hpp>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+
+/*!	ResultCache maps (structural expression hash, hash of the variables it reads) to the result.
+
+	Entries expire after a time-to-live and the least recently used entry is evicted once
+	the cache holds its maximum number of entries.  Not synchronized.
+	*/
+class ResultCache {
+	// Block copying
+	ResultCache(ResultCache const&) = delete;
+	ResultCache& operator = (ResultCache const&) = delete;
+
+// TYPES
+public:
+	using clock_type = std::chrono::steady_clock;
+	using value_type = Operand::pointer_type;
+
+	/*! Cache key: the expression and a snapshot of its inputs. */
+	struct Key {
+		Hash128	expression;
+		Hash128	inputs;
+		[[nodiscard]] constexpr bool operator == (Key const&) const = default;
+	};
+
+	/*! Cache usage counters. */
+	struct Statistics {
+		std::uint64_t	hits = 0;
+		std::uint64_t	misses = 0;
+		std::uint64_t	bypasses = 0;		/// evaluations that could not be cached.
+		std::uint64_t	expirations = 0;
+		std::uint64_t	evictions = 0;
+		std::size_t		entries = 0;
+
+		[[nodiscard]] double hit_rate() const { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+	};
+
+private:
+	struct KeyHash {
+		[[nodiscard]] std::size_t operator()(Key const& key) const noexcept {
+			return std::hash<Hash128>()(key.expression) ^ (std::hash<Hash128>()(key.inputs) * 31);
+		}
+	};
+	struct Entry {
+		Key						key;
+		value_type				value;
+		clock_type::time_point	expires;
+	};
+	using lru_type = std::list<Entry>;
+	using index_type = std::unordered_map<Key, lru_type::iterator, KeyHash>;
+
+// VALUES
+public:
+	static constexpr std::size_t default_capacity_c = 4096;
+	static constexpr clock_type::duration default_ttl_c = std::chrono::minutes(5);
+
+// ATTRIBUTES
+private:
+	lru_type				lru_m;			/// most recently used first.
+	index_type				index_m;
+	std::size_t				capacity_m;
+	clock_type::duration	ttl_m;
+	Statistics				stats_m;
+
+// OPERATIONS
+public:
+	explicit ResultCache(std::size_t capacity = default_capacity_c, clock_type::duration ttl = default_ttl_c)
+		: capacity_m(capacity), ttl_m(ttl) { }
+
+	[[nodiscard]] std::optional<value_type> find(Key const& key);
+	void insert(Key const& key, value_type const& value);
+	void note_bypass() { ++stats_m.bypasses; }
+	void purge_expired();
+	void clear();
+
+	[[nodiscard]] Statistics const& statistics() const { return stats_m; }
+	[[nodiscard]] std::size_t capacity() const { return capacity_m; }
+	[[nodiscard]] clock_type::duration ttl() const { return ttl_m; }
+
+	[[nodiscard]] static std::optional<Hash128> hash_inputs(TokenList const& rpnExpression);
+	[[nodiscard]] static bool is_cacheable(TokenList const& rpnExpression);
+
+private:
+	void _erase(lru_type::iterator entry);
+};
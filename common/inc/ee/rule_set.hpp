@@ -0,0 +1,120 @@
+#pragma once
+/*!	\file	rule_set.hpp
+	\brief	RuleSet class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the RuleSet class, a rule file of expressions
+compiled to postfix in parallel.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/error.hpp>
+#include <ee/symbol_table.hpp>
+#include <ee/token.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+/*!	CompiledRule is one line of a rule file, tokenized and parsed to postfix.  Immutable. */
+class CompiledRule {
+// ATTRIBUTES
+private:
+	std::size_t	line_m;
+	TokenList	postfix_m;
+	Error		error_m;
+
+// OPERATIONS
+public:
+	CompiledRule(std::size_t line, TokenList postfix, Error error) : line_m(line), postfix_m(std::move(postfix)), error_m(error) { }
+
+	/*! Gets the 0-based line number in the rule file. */
+	[[nodiscard]] std::size_t line() const { return line_m; }
+
+	/*! Gets the postfix program; empty if the rule has an error. */
+	[[nodiscard]] TokenList const& postfix() const { return postfix_m; }
+
+	/*! Gets the error, with the character offset in the line. */
+	[[nodiscard]] Error error() const { return error_m; }
+};
+
+
+
+/*!	RuleSet compiles a rule file, one expression per line, on several threads.
+
+	The text is split on line boundaries into a few chunks per thread; each thread takes the
+	next chunk with its own Tokenizer and Parser until none are left.  The tokenizers share
+	one SymbolTable, so a variable name means the same Variable token in every rule.
+	Blank lines are skipped; a line that fails to compile is kept, with its error.
+	*/
+class RuleSet {
+// TYPES
+public:
+	using rule_list_type = std::vector<CompiledRule>;
+
+	struct Statistics {
+		std::uint64_t	lines = 0;
+		std::uint64_t	rules = 0;			/// non-blank lines, including those in error.
+		std::uint64_t	errors = 0;
+		std::size_t		chunks = 0;
+		unsigned		threads = 0;
+		double			seconds = 0.0;		/// including mapping the file.
+
+		[[nodiscard]] double rules_per_second() const { return seconds > 0.0 ? double(rules) / seconds : 0.0; }
+	};
+
+// VALUES
+public:
+	static constexpr unsigned chunks_per_thread_c = 4;
+	static constexpr std::size_t min_chunk_size_c = 4096;	/// bytes; smaller inputs use fewer threads.
+
+// ATTRIBUTES
+private:
+	std::shared_ptr<SymbolTable>	symbols_m;
+	rule_list_type					rules_m;
+	Statistics						stats_m;
+
+// OPERATIONS
+public:
+	/*! Compiles rules; the variables are interned in 'symbols', or in a new table if it is nullptr.
+		@param threadCount [in] 0 for one thread per hardware thread.
+		*/
+	[[nodiscard]] static RuleSet compile(std::string_view text, unsigned threadCount = 0, std::shared_ptr<SymbolTable> symbols = nullptr);
+
+	/*! Maps a rule file into memory and compiles it.  Throws std::system_error if the file can't be read. */
+	[[nodiscard]] static RuleSet load(std::string const& path, unsigned threadCount = 0, std::shared_ptr<SymbolTable> symbols = nullptr);
+
+	/*! Gets the compiled rules, in file order. */
+	[[nodiscard]] rule_list_type const& rules() const { return rules_m; }
+
+	/*! Gets the table of the variables that the rules use. */
+	[[nodiscard]] std::shared_ptr<SymbolTable> const& symbols() const { return symbols_m; }
+
+	[[nodiscard]] Statistics const& statistics() const { return stats_m; }
+
+private:
+	RuleSet() = default;
+};
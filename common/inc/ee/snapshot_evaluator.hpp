@@ -0,0 +1,151 @@
+#pragma once
+/*!	\file	snapshot_evaluator.hpp
+	\brief	SnapshotEvaluator class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the VariableSnapshot and SnapshotEvaluator
+classes, parallel evaluation of many expressions against one
+immutable set of variable values.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/error.hpp>
+#include <ee/operand.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/rule_set.hpp>
+#include <ee/thread_pool.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+/*!	VariableSnapshot is an immutable set of variable values, keyed by Variable token.
+	Evaluating against a snapshot reads the values from it instead of from the variables,
+	so the variables may change while the evaluation runs.
+	*/
+class VariableSnapshot {
+// TYPES
+public:
+	using value_list_type = std::vector<std::pair<Token::pointer_type, Operand::pointer_type>>;
+
+// ATTRIBUTES
+private:
+	std::unordered_map<Token const*, Operand::pointer_type>	values_m;
+	TokenList	variables_m;		/// keeps the keys alive.
+
+// OPERATIONS
+public:
+	VariableSnapshot() = default;
+
+	/*! Makes a snapshot of the given (variable, value) pairs; a null value leaves the variable uninitialized. */
+	explicit VariableSnapshot(value_list_type const& values);
+
+	/*! Makes a snapshot of the current values of some variables. */
+	[[nodiscard]] static VariableSnapshot capture(TokenList const& variables);
+
+	/*! Gets the value of a variable, or nullptr if it is uninitialized or not in the snapshot. */
+	[[nodiscard]] Operand::pointer_type find(Token const* variable) const {
+		auto iter = values_m.find(variable);
+		return iter == values_m.end() ? nullptr : iter->second;
+	}
+
+	[[nodiscard]] std::size_t size() const { return values_m.size(); }
+};
+
+
+
+/*!	SnapshotEvaluator evaluates many different compiled expressions against one VariableSnapshot,
+	spread over a pool of worker threads, each with its own RPNEvaluator.
+
+	The variables of each expression are replaced by their snapshot values before it is evaluated,
+	so the workers share no mutable state.  An expression that assigns a variable can't run that
+	way: depending on the policy it is rejected, or run after the parallel pass, in input order
+	on the calling thread, with its assignments visible to the later serialized expressions only.
+
+	The parallel pass is ordered by CostEstimator, the most expensive expressions first, in
+	chunks of about equal estimated cost.
+	*/
+class SnapshotEvaluator {
+	// Block copying
+	SnapshotEvaluator(SnapshotEvaluator const&) = delete;
+	SnapshotEvaluator& operator = (SnapshotEvaluator const&) = delete;
+
+// TYPES
+public:
+	enum class AssignmentPolicy : std::uint8_t { Reject, Serialize };
+
+	/*! The outcome of one expression; errors are located by token index. */
+	struct Outcome {
+		Operand::pointer_type	value;
+		Error					error;
+	};
+
+	struct Report {
+		std::size_t		parallel = 0;		/// expressions evaluated by the pool.
+		std::size_t		serialized = 0;
+		std::size_t		rejected = 0;
+		std::size_t		errors = 0;			/// including the rejected expressions.
+		std::size_t		chunks = 0;			/// pieces of work handed to the workers.
+		double			estimatedUnits = 0.0;	/// total estimated cost (see CostEstimator).
+		double			seconds = 0.0;
+
+		/*! The final values of the variables assigned by the serialized expressions, to build the next snapshot. */
+		VariableSnapshot::value_list_type	assignments;
+	};
+
+// VALUES
+public:
+	static constexpr std::size_t grain_c = 64;	/// expressions handed to a worker at a time, at most.
+	static constexpr std::size_t chunks_per_worker_c = 8;	/// chunks of equal estimated cost per worker, when costs vary.
+
+// ATTRIBUTES
+private:
+	ThreadPool									pool_m;
+	std::vector<std::unique_ptr<RPNEvaluator>>	evaluators_m;	/// one per worker.
+	std::vector<TokenList>						bound_m;		/// one per worker: the expression with the values in place.
+	AssignmentPolicy							policy_m;
+
+// OPERATIONS
+public:
+	/*! @param threadCount [in] workers, including the caller; 0 for one per hardware thread. */
+	explicit SnapshotEvaluator(unsigned threadCount = 0, AssignmentPolicy policy = AssignmentPolicy::Reject);
+
+	/*! Evaluates expressions[i] into results[i].  Throws std::invalid_argument if 'results' is too small. */
+	Report evaluate(std::span<TokenList const> expressions, VariableSnapshot const& snapshot, std::span<Outcome> results);
+
+	/*! As above, for compiled rules; a rule that failed to compile gets its compile error. */
+	Report evaluate(std::span<CompiledRule const> rules, VariableSnapshot const& snapshot, std::span<Outcome> results);
+
+	[[nodiscard]] AssignmentPolicy policy() const { return policy_m; }
+	[[nodiscard]] unsigned thread_count() const { return pool_m.size(); }
+
+	[[nodiscard]] static bool assigns(TokenList const& rpnExpression);
+
+private:
+	template <typename SOURCE>
+	Report _evaluate(std::size_t count, SOURCE const& source, VariableSnapshot const& snapshot, std::span<Outcome> results);
+};
@@ -0,0 +1,171 @@
+#pragma once
+/*!	\file	spsc_queue.hpp
+	\brief	SpscQueue class template.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the SpscQueue class template, a bounded lock-free
+single-producer/single-consumer queue.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+/*! Usage counters of a queue; read them once both threads are done with the queue. */
+struct QueueStatistics {
+	std::size_t		capacity = 0;
+	std::uint64_t	pushes = 0;
+	std::uint64_t	producerStalls = 0;		/// pushes that found the queue full.
+	std::uint64_t	consumerStalls = 0;		/// pops that found the queue empty.
+	std::uint64_t	occupancySum = 0;		/// items queued, summed over every pop.
+
+	[[nodiscard]] double mean_occupancy() const { return pushes ? double(occupancySum) / double(pushes) : 0.0; }
+};
+
+
+
+/*!	SpscQueue is a bounded ring buffer for exactly one producer thread and one consumer thread.
+
+	push() blocks while the queue is full (backpressure) and pop() blocks while it is empty,
+	spinning briefly and then yielding.  The producer close()s the queue when it is done.
+	Each side caches the other side's index, so the shared indices are only read when the
+	cached one says the queue looks full (or empty).
+	*/
+template <typename T>
+class SpscQueue {
+	// Block copying
+	SpscQueue(SpscQueue const&) = delete;
+	SpscQueue& operator = (SpscQueue const&) = delete;
+
+// TYPES
+public:
+	using value_type = T;
+
+	using Statistics = QueueStatistics;
+
+// VALUES
+private:
+	static constexpr std::size_t cache_line_c = 64;
+	static constexpr unsigned spin_limit_c = 64;
+
+// ATTRIBUTES
+private:
+	std::vector<T>								slots_m;
+	std::size_t									mask_m;
+	std::atomic<bool>							closed_m{ false };
+
+	alignas(cache_line_c) std::atomic<std::size_t>	head_m{ 0 };	/// next slot to pop; written by the consumer.
+	std::size_t									tailCache_m = 0;
+	std::uint64_t								consumerStalls_m = 0;
+	std::uint64_t								occupancySum_m = 0;
+
+	alignas(cache_line_c) std::atomic<std::size_t>	tail_m{ 0 };	/// next slot to push; written by the producer.
+	std::size_t									headCache_m = 0;
+	std::uint64_t								producerStalls_m = 0;
+
+// OPERATIONS
+public:
+	/*! @param capacity [in] rounded up to a power of two. */
+	explicit SpscQueue(std::size_t capacity)
+		: slots_m(std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity)), mask_m(slots_m.size() - 1) { }
+
+	/*! Adds an item unless the queue is full; 'value' is moved from only on success. Producer only. */
+	[[nodiscard]] bool try_push(T& value) {
+		auto const tail = tail_m.load(std::memory_order_relaxed);
+		if (tail - headCache_m == slots_m.size()) {
+			headCache_m = head_m.load(std::memory_order_acquire);
+			if (tail - headCache_m == slots_m.size())
+				return false;
+		}
+		slots_m[tail & mask_m] = std::move(value);
+		tail_m.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*! Adds an item, waiting while the queue is full. Producer only. */
+	void push(T value) {
+		if (try_push(value))
+			return;
+		++producerStalls_m;
+		for (unsigned spins = 0; !try_push(value); )
+			_backoff(spins);
+	}
+
+	/*! Removes the oldest item unless the queue is empty. Consumer only. */
+	[[nodiscard]] bool try_pop(T& value) {
+		auto const head = head_m.load(std::memory_order_relaxed);
+		if (head == tailCache_m) {
+			tailCache_m = tail_m.load(std::memory_order_acquire);
+			if (head == tailCache_m)
+				return false;
+		}
+		value = std::move(slots_m[head & mask_m]);
+		occupancySum_m += tailCache_m - head;
+		head_m.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*! Removes the oldest item, waiting while the queue is empty. Consumer only.
+		@return false once the queue is closed and empty.
+		*/
+	[[nodiscard]] bool pop(T& value) {
+		if (try_pop(value))
+			return true;
+		++consumerStalls_m;
+		for (unsigned spins = 0; ; _backoff(spins)) {
+			if (try_pop(value))
+				return true;
+			if (closed_m.load(std::memory_order_acquire))
+				return try_pop(value);		// items pushed before close() are visible now
+		}
+	}
+
+	/*! Marks the end of the items. Producer only. */
+	void close() { closed_m.store(true, std::memory_order_release); }
+
+	/*! Tests if the queue is closed and every item has been popped. Consumer only. */
+	[[nodiscard]] bool drained() const {
+		return closed_m.load(std::memory_order_acquire) && head_m.load(std::memory_order_relaxed) == tail_m.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]] std::size_t capacity() const { return slots_m.size(); }
+
+	[[nodiscard]] Statistics statistics() const {
+		return Statistics{ slots_m.size(), tail_m.load(std::memory_order_acquire), producerStalls_m, consumerStalls_m, occupancySum_m };
+	}
+
+private:
+	static void _backoff(unsigned& spins) {
+		if (spins < spin_limit_c)
+			++spins;
+		else
+			std::this_thread::yield();
+	}
+};
@@ -0,0 +1,74 @@
+#pragma once
+/*!	\file	stream_parser.hpp
+	\brief	StreamParser class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the StreamParser class, which tokenizes and
+parses very long expressions without holding them in memory.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/parser.hpp>
+#include <ee/tokenizer.hpp>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+
+/*!	StreamParser converts an infix expression read from a stream or a memory buffer
+	(e.g. a memory-mapped file) to postfix, sending each postfix token to a TokenSink.
+
+	The stream is read in chunks, and each chunk is cut just before an operator character that
+	cannot continue the previous token.  Memory use is one chunk plus the parser's operator stack
+	(proportional to nesting depth) plus whatever the sink keeps; the input is never held whole.
+	Errors report the offset in the whole input and carry no copy of the source text.
+	*/
+class StreamParser {
+	StreamParser(StreamParser const&) = delete;
+	StreamParser& operator = (StreamParser const&) = delete;
+
+public:
+	static constexpr std::size_t default_chunk_size_c = 64 * 1024;
+
+private:
+	Tokenizer&	tokenizer_m;
+	Parser		parser_m;
+	std::size_t	chunkSize_m;
+	std::size_t	peakBuffer_m = 0;
+
+public:
+	explicit StreamParser(Tokenizer& tokenizer, std::size_t chunkSize = default_chunk_size_c)
+		: tokenizer_m(tokenizer), chunkSize_m(chunkSize ? chunkSize : 1) { }
+
+	void parse(std::istream& in, TokenSink& output);
+	void parse(std::string_view source, TokenSink& output);
+
+	/*! Gets the largest number of input characters buffered at once by the last parse. */
+	[[nodiscard]] std::size_t peak_buffer() const { return peakBuffer_m; }
+
+private:
+	void _parse_piece(Tokenizer::Cursor& cursor, TokenSink& output);
+	void _finish(Tokenizer::Cursor const& cursor, TokenSink& output);
+	[[nodiscard]] static std::size_t _safe_cut(std::string_view buffer);
+};
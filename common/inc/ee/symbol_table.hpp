@@ -0,0 +1,79 @@
+#pragma once
+/*!	\file	symbol_table.hpp
+	\brief	SymbolTable class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the SymbolTable class, a concurrent table of
+interned variable tokens.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <array>
+#include <cstddef>
+#include <shared_mutex>
+#include <unordered_map>
+
+
+/*!	SymbolTable interns variable names: every lookup of a name gets the same Variable token.
+
+	It may be shared by many threads.  The names are spread over shards, each with its own
+	reader/writer lock, so lookups of different names rarely contend and lookups of names
+	that already exist only take a shared lock.
+	*/
+class SymbolTable {
+	// Block copying
+	SymbolTable(SymbolTable const&) = delete;
+	SymbolTable& operator = (SymbolTable const&) = delete;
+
+// TYPES
+public:
+	using string_type = Token::string_type;
+
+private:
+	struct alignas(64) Shard {
+		mutable std::shared_mutex								mutex;
+		std::unordered_map<string_type, Token::pointer_type>	variables;
+	};
+
+// VALUES
+public:
+	static constexpr std::size_t shard_count_c = 64;
+
+// ATTRIBUTES
+private:
+	std::array<Shard, shard_count_c>	shards_m;
+
+// OPERATIONS
+public:
+	SymbolTable() = default;
+
+	[[nodiscard]] Token::pointer_type intern(string_type const& name);
+	[[nodiscard]] Token::pointer_type find(string_type const& name) const;
+	[[nodiscard]] std::size_t size() const;
+
+private:
+	[[nodiscard]] Shard& _shard(string_type const& name) { return shards_m[std::hash<string_type>()(name) % shard_count_c]; }
+	[[nodiscard]] Shard const& _shard(string_type const& name) const { return shards_m[std::hash<string_type>()(name) % shard_count_c]; }
+};
@@ -0,0 +1,95 @@
+#pragma once
+/*!	\file	thread_pool.hpp
+	\brief	ThreadPool class declaration.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Declaration of the ThreadPool class, a fixed set of worker
+threads for data-parallel loops.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*!	ThreadPool keeps worker threads alive between parallel loops, so a loop only costs a wake-up.
+
+	The calling thread takes part in each loop as worker 0; the pool threads are workers 1 to
+	size() - 1, so per-worker state can be kept in an array indexed by the worker number.
+	One loop runs at a time; concurrent callers wait their turn.
+
+	submit() queues a task for the pool threads instead, and returns at once.  A worker busy
+	with a task joins a loop when the task is done.
+	*/
+class ThreadPool {
+	// Block copying
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator = (ThreadPool const&) = delete;
+
+// TYPES
+public:
+	/*! Loop body: processes the items [begin, end) on a worker. */
+	using body_type = std::function<void(std::size_t begin, std::size_t end, unsigned worker)>;
+
+// ATTRIBUTES
+private:
+	std::vector<std::thread>	threads_m;
+	std::mutex					loop_m;			/// held for the whole of a parallel_for().
+	std::mutex					mutex_m;		/// guards the members below.
+	std::condition_variable		wake_m;
+	std::condition_variable		done_m;
+	std::function<void(unsigned)>	job_m;
+	std::deque<std::function<void()>>	tasks_m;
+	std::uint64_t				generation_m = 0;
+	unsigned					running_m = 0;
+	bool						stopping_m = false;
+
+// OPERATIONS
+public:
+	/*! @param threadCount [in] total workers, including the caller; 0 for one per hardware thread. */
+	explicit ThreadPool(unsigned threadCount = 0);
+	~ThreadPool();
+
+	/*! Gets the number of workers, including the calling thread. */
+	[[nodiscard]] unsigned size() const { return unsigned(threads_m.size()) + 1; }
+
+	void parallel_for(std::size_t count, std::size_t grain, body_type const& body);
+
+	/*! Runs 'task' on a pool thread, or at once on the caller if the pool has no threads.
+		Exceptions thrown by the task are discarded: report results through a promise.
+		*/
+	void submit(std::function<void()> task);
+
+	/*! Gets the process-wide pool for submit(), with a thread per hardware thread. */
+	[[nodiscard]] static ThreadPool& shared();
+
+private:
+	void _work(unsigned worker);
+};
@@ -12,6 +12,9 @@ Declarations of the Token class.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added TokenSink
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -128,6 +131,15 @@ using TokenList = std::vector<Token::pointer_type>;
 
 
 
+/*! Receiver of a stream of tokens, one at a time (e.g. parser output fed straight to an evaluator). */
+class TokenSink {
+public:
+	virtual ~TokenSink() = default;
+	virtual void push(Token::pointer_type const& token) = 0;
+};
+
+
+
 /*! stream operators */
 inline std::ostream& operator << (std::ostream& os, Token const& token) {
 	return os << token.str();
@@ -9,6 +9,16 @@
 Revision History
 ------------------------------------------------------------ -
 
+Version 2026.10.17
+	Added get_variable()
+	Added Cursor and next_token().
+	Added Cursor::token_offset().
+	Cursor scans string_view pieces; exceptions without a source copy.
+	Added try_tokenize() and try_next_token().
+	Cursor keeps the lexer DFA state instead of the previous token.
+	Cursor can resume mid-input in a given state.
+	Can intern variables in a SymbolTable shared with other tokenizers.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -55,13 +65,19 @@ stipulated in the agreement / contract under which
 the program(s) have been supplied.
 ============================================================= */
 
+#include <ee/error.hpp>
+#include <ee/symbol_table.hpp>
 #include <ee/token.hpp>
+#include <cstdint>
 #include <map>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 
 /*! Tokenizer class is used to create lists of tokens from expression strings.
-	It maintains a dictionary of variable tokens introduced by the expression strings.
+	It maintains a dictionary of variable tokens introduced by the expression strings,
+	or interns them in a SymbolTable that tokenizers on other threads share.
 	*/
 class Tokenizer {
 	// Block copying
@@ -82,6 +98,12 @@ public:
 			, location_m(location)
 		{ }
 
+		/*! Error without a copy of the source text (streamed input); expression() is empty. */
+		XTokenizer(std::size_t location, char const* msg)
+			: std::runtime_error(msg)
+			, location_m(location)
+		{ }
+
 		/*! Gets the expression string containing the bad character. */
 		[[nodiscard]] constexpr string_type expression() const { return expression_m; }
 
@@ -93,6 +115,8 @@ public:
 	struct XBadCharacter : public XTokenizer {
 	XBadCharacter(string_type const& expression, std::size_t location)
 		: XTokenizer(expression, location, "Tokenizer::Bad character in expression.") { }
+	explicit XBadCharacter(std::size_t location)
+		: XTokenizer(location, "Tokenizer::Bad character in expression.") { }
 	};
 
 	/**	Numeric overflow exception class. */
@@ -101,6 +125,57 @@ public:
 			: XTokenizer( expression, location, "Tokenizer::Too many digits in number." ) { }
 	};
 
+	/** Scanning position within an expression, for next_token().
+		The text must outlive the cursor.  Offsets count from the start of the whole input,
+		which may be scanned in consecutive pieces with continue_with().
+		*/
+	class Cursor {
+		friend class Tokenizer;
+	public:
+		using iterator_type = std::string_view::const_iterator;
+
+		/*! Lexer state: what the next token is expected to be.  Decides unary vs. binary +/-. */
+		enum class State : std::uint8_t { ExpectOperand, ExpectOperator };
+
+	private:
+		std::string_view	expression_m;
+		iterator_type		current_m;
+		iterator_type		start_m;				/// first character of the last token.
+		std::size_t			base_m = 0;				/// offset of expression_m in the whole input.
+		State				state_m = State::ExpectOperand;	/// decided by the previous token.
+		bool				copySource_m = true;	/// exceptions carry a copy of the text.
+	public:
+		/*! @param copySource [in] false to throw exceptions with only the error offset (large or streamed input). */
+		explicit Cursor(std::string_view expression, bool copySource = true)
+			: expression_m(expression), current_m(expression.cbegin()), start_m(current_m), copySource_m(copySource) { }
+
+		/*! Resumes scanning in the middle of an input.
+			@param rest [in] the input from offset 'base' on.
+			@param state [in] the lexer state at 'base', i.e. state() after the token before it.
+			*/
+		Cursor(std::string_view rest, std::size_t base, State state, bool copySource = true)
+			: expression_m(rest), current_m(rest.cbegin()), start_m(current_m), base_m(base), state_m(state), copySource_m(copySource) { }
+
+		/*! Continues scanning with the next piece of the input, once this piece is used up. */
+		void continue_with(std::string_view next) {
+			base_m += expression_m.size();
+			expression_m = next;
+			current_m = start_m = next.cbegin();
+		}
+
+		/*! Gets the offset of the next unscanned character. */
+		[[nodiscard]] std::size_t offset() const { return base_m + std::size_t(current_m - expression_m.cbegin()); }
+
+		/*! Gets the offset of the first character of the last token scanned. */
+		[[nodiscard]] std::size_t token_offset() const { return base_m + std::size_t(start_m - expression_m.cbegin()); }
+
+		/*! Gets the lexer state: what the next token is expected to be. */
+		[[nodiscard]] State state() const { return state_m; }
+
+		/*! Tests if this piece of the input is used up. */
+		[[nodiscard]] bool at_end() const { return current_m == expression_m.cend(); }
+	};
+
 private:
 	using dictionary_type = std::map<string_type, Token::pointer_type>;
 
@@ -108,14 +183,22 @@ private:
 private:
 	dictionary_type	keywords_m;
 	dictionary_type variables_m;
+	SymbolTable*	symbols_m = nullptr;		/// used instead of variables_m when set.
 
 // OPERATIONS
 public:
 	Tokenizer();
+	explicit Tokenizer(SymbolTable& symbols);
 	TokenList tokenize(string_type const& expression);
+	[[nodiscard]] Token::pointer_type next_token(Cursor& cursor);
+	[[nodiscard]] Expected<TokenList> try_tokenize(string_type const& expression);
+	[[nodiscard]] Token::pointer_type try_next_token(Cursor& cursor, Error& error);
+	[[nodiscard]] Token::pointer_type get_variable(string_type const& name);
 
 private:
-	[[nodiscard]] Token::pointer_type _get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
-	[[nodiscard]] Token::pointer_type _get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
+	[[nodiscard]] Token::pointer_type _get_identifier(Cursor& cursor);
+	[[nodiscard]] Token::pointer_type _get_number(Cursor& cursor, Error& error);
+	static Token::pointer_type _fail(Cursor const& cursor, Cursor::iterator_type at, ErrorCode code, Error& error);
+	[[noreturn]] static void _throw(Cursor const& cursor, Error const& error);
 };
 
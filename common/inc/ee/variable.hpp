@@ -12,6 +12,9 @@ Declarations of the Variable class derived from Operand.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added name()
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -51,9 +54,12 @@ public:
 	using value_type = Operand::pointer_type;
 private:
 	value_type	value_m;
+	string_type	name_m;
 public:
 	Variable() = default;
+	Variable(string_type const& name) : name_m(name) { }
 	[[nodiscard]]	value_type	value() const { return value_m; }
+	[[nodiscard]]	string_type	const& name() const { return name_m; }
 					void		set(Operand::pointer_type const& value) { value_m = value; }
 	[[nodiscard]]	string_type	str() const override;
 };
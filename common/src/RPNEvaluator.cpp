@@ -8,6 +8,13 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added optional FunctionCache for pure function calls.
+	Split evaluate() into push() and finish().
+	Added try_evaluate(), try_push(), try_finish(); the throwing functions wrap them.
+	Added EvaluationLimits, checked per operation and in the Factorial and Power loops.
+	Added use_cancellation(), checked with the limits.
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -35,6 +42,7 @@ the program(s) have been supplied.
 #include <ee/integer.hpp>
 #include <ee/operation.hpp>
 #include <ee/function.hpp>
+#include <ee/function_cache.hpp>
 #include <ee/real.hpp>
 #include <ee/boolean.hpp>
 #include <ee/variable.hpp>
@@ -50,31 +58,31 @@ the program(s) have been supplied.
 
 
 
-[[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate( TokenList const& rpnExpression ) {
+namespace {
         using Value = std::variant<Integer::value_type, Real::value_type, bool>;
 
-        std::function<Value(Operand::pointer_type const&)> to_value = [&](Operand::pointer_type const& operand) -> Value {
-                if (is<Integer>(operand)) return value_of<Integer>(operand);
-                if (is<Real>(operand)) return value_of<Real>(operand);
-                if (is<Boolean>(operand)) return value_of<Boolean>(operand);
+        [[nodiscard]] ErrorCode to_value(Operand::pointer_type const& operand, Value& value) {
+                if (is<Integer>(operand)) { value = value_of<Integer>(operand); return ErrorCode::None; }
+                if (is<Real>(operand)) { value = value_of<Real>(operand); return ErrorCode::None; }
+                if (is<Boolean>(operand)) { value = value_of<Boolean>(operand); return ErrorCode::None; }
                 if (is<Variable>(operand)) {
                         auto var = convert<Variable>(operand);
                         if (!var->value())
-                                throw std::runtime_error("Error: variable not initialized");
-                        return to_value(var->value());
+                                return ErrorCode::VariableNotInitialized;
+                        return to_value(var->value(), value);
                 }
-                throw std::runtime_error("Error: unsupported operand");
-        };
+                return ErrorCode::UnsupportedOperand;
+        }
 
-        auto make_operand_from_value = [](Value const& value) -> Operand::pointer_type {
+        [[nodiscard]] Operand::pointer_type make_operand_from_value(Value const& value) {
                 if (std::holds_alternative<Integer::value_type>(value))
                         return make_operand<Integer>(std::get<Integer::value_type>(value));
                 if (std::holds_alternative<Real::value_type>(value))
                         return make_operand<Real>(std::get<Real::value_type>(value));
                 return make_operand<Boolean>(std::get<bool>(value));
-        };
+        }
 
-        auto promote = [](Value const& lhs, Value const& rhs) -> std::pair<Value, Value> {
+        [[nodiscard]] std::pair<Value, Value> promote(Value const& lhs, Value const& rhs) {
                 if (std::holds_alternative<Real::value_type>(lhs) || std::holds_alternative<Real::value_type>(rhs)) {
                         auto to_real = [](Value const& v) {
                                 if (std::holds_alternative<Real::value_type>(v)) return std::get<Real::value_type>(v);
@@ -84,227 +92,393 @@ the program(s) have been supplied.
                         return { to_real(lhs), to_real(rhs) };
                 }
                 return { lhs, rhs };
-        };
+        }
+}
 
-        OperandList stack;
 
-        for (auto const& token : rpnExpression) {
-                if (is<Operand>(token)) {
-                        stack.push_back(convert<Operand>(token));
-                        continue;
-                }
 
-                if (!is<Operation>(token))
-                        continue;
-
-                if (is<PostfixOperator>(token)) {
-                        if (stack.size() < 1)
-                                throw std::runtime_error("Error: insufficient operands");
-                        auto operand = stack.back();
-                        stack.pop_back();
-                        Value val = to_value(operand);
-                        if (!std::holds_alternative<Integer::value_type>(val))
-                                throw std::runtime_error("Error: unsupported operand");
-                        auto ival = std::get<Integer::value_type>(val);
-                        if (ival < 0)
-                                throw std::runtime_error("Error: unsupported operand");
-                        Integer::value_type result = 1;
-                        for (Integer::value_type i = 1; i <= ival; ++i)
-                                result *= i;
-                        stack.push_back(make_operand<Integer>(result));
-                        continue;
+/*! Declares 'var' and sets it to the value of 'operand', returning the error code if there is none. */
+#define GET_VALUE(var, operand)\
+        Value var;\
+        if (auto const code = to_value(operand, var); code != ErrorCode::None)\
+                return code;
+
+
+
+/*!	Evaluates a postfix expression.
+	@return the result.
+	@param rpnExpression [in] the postfix expression from Parser::parse().
+	*/
+[[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate( TokenList const& rpnExpression ) {
+        reset();
+        for (auto const& token : rpnExpression)
+                push(token);
+        return finish();
+}
+
+
+
+/*!	Evaluates a postfix expression without throwing.
+	@return the result, or the error and the index of the token where it occurred
+		(the number of tokens if it was found at the end).
+	@param rpnExpression [in] the postfix expression from Parser::parse().
+	*/
+[[nodiscard]] Expected<Operand::pointer_type> RPNEvaluator::try_evaluate(TokenList const& rpnExpression) {
+        reset();
+        for (std::size_t i = 0; i < rpnExpression.size(); ++i)
+                if (auto const code = try_push(rpnExpression[i]); code != ErrorCode::None)
+                        return Error{ code, i };
+
+        auto result = try_finish();
+        if (!result)
+                return Error{ result.error().code, rpnExpression.size() };
+        return result;
+}
+
+
+
+/*!	Evaluates the next token of a postfix expression against the value stack. */
+void RPNEvaluator::push(Token::pointer_type const& token) {
+        if (auto const code = _evaluate(token); code != ErrorCode::None)
+                throw std::runtime_error(message(code));
+}
+
+
+
+/*!	Evaluates the next token without throwing (see push()).
+	@return the error, or ErrorCode::None.
+	*/
+[[nodiscard]] ErrorCode RPNEvaluator::try_push(Token::pointer_type const& token) noexcept {
+        try {
+                return _evaluate(token);
+        }
+        catch (std::exception const&) {
+                return ErrorCode::EvaluationFailed;
+        }
+}
+
+
+
+void RPNEvaluator::reset() {
+        stack_m.clear();
+        steps_m = 0;
+        if (limits_m.timeLimit.count() > 0)
+                deadline_m = std::chrono::steady_clock::now() + limits_m.timeLimit;
+}
+
+
+
+void RPNEvaluator::set_limits(EvaluationLimits const& limits) {
+        limits_m = limits;
+        maxLimbs_m = limits.maxDigits ? std::size_t(std::ceil(double(limits.maxDigits) * std::log2(10.0) / 64.0)) : 0;
+}
+
+
+
+/*!	Counts a step against the limits, and checks the time limit and the cancellation token.
+	Long loops call it once per iteration.
+	*/
+[[nodiscard]] ErrorCode RPNEvaluator::_checkpoint() {
+        if (cancel_m && cancel_m->cancelled())
+                return ErrorCode::Cancelled;
+        ++steps_m;
+        if (limits_m.maxSteps && steps_m > limits_m.maxSteps)
+                return ErrorCode::StepLimitExceeded;
+        if (limits_m.timeLimit.count() > 0 && std::chrono::steady_clock::now() > deadline_m)
+                return ErrorCode::TimeLimitExceeded;
+        return ErrorCode::None;
+}
+
+
+
+/*!	Evaluates the next token within the limits; errors in the operands are returned, library failures are thrown. */
+[[nodiscard]] ErrorCode RPNEvaluator::_evaluate(Token::pointer_type const& token) {
+        if (!is<Operation>(token))
+                return _apply(token);
+        if (auto const code = _checkpoint(); code != ErrorCode::None)
+                return code;
+
+        auto const code = _apply(token);
+        if (code == ErrorCode::None && maxLimbs_m && !stack_m.empty())
+                if (auto const integer = dynamic_cast<Integer const*>(stack_m.back().get()); integer && !_fits(integer->value()))
+                        return ErrorCode::DigitLimitExceeded;
+        return code;
+}
+
+
+
+/*!	Evaluates the next token. */
+[[nodiscard]] ErrorCode RPNEvaluator::_apply(Token::pointer_type const& token) {
+        if (is<Operand>(token)) {
+                stack_m.push_back(convert<Operand>(token));
+                return ErrorCode::None;
+        }
+
+        if (!is<Operation>(token))
+                return ErrorCode::None;
+
+        if (is<PostfixOperator>(token)) {
+                if (stack_m.size() < 1)
+                        return ErrorCode::InsufficientOperands;
+                auto operand = stack_m.back();
+                stack_m.pop_back();
+                GET_VALUE(val, operand)
+                if (!std::holds_alternative<Integer::value_type>(val))
+                        return ErrorCode::UnsupportedOperand;
+                auto ival = std::get<Integer::value_type>(val);
+                if (ival < 0)
+                        return ErrorCode::UnsupportedOperand;
+                if (limits_m.maxSteps && ival > limits_m.maxSteps - std::min(steps_m, limits_m.maxSteps))
+                        return ErrorCode::StepLimitExceeded;
+                Integer::value_type result = 1;
+                for (Integer::value_type i = 1; i <= ival; ++i) {
+                        if (auto const code = _checkpoint(); code != ErrorCode::None)
+                                return code;
+                        result *= i;
+                        if (!_fits(result))
+                                return ErrorCode::DigitLimitExceeded;
                 }
+                stack_m.push_back(make_operand<Integer>(result));
+                return ErrorCode::None;
+        }
 
-                if (is<UnaryOperator>(token)) {
-                        if (stack.size() < 1)
-                                throw std::runtime_error("Error: insufficient operands");
-                        auto operand = stack.back();
-                        stack.pop_back();
-                        Value val = to_value(operand);
+        if (is<UnaryOperator>(token)) {
+                if (stack_m.size() < 1)
+                        return ErrorCode::InsufficientOperands;
+                auto operand = stack_m.back();
+                stack_m.pop_back();
+                GET_VALUE(val, operand)
 
-                        if (is<Identity>(token)) {
-                                stack.push_back(operand);
-                                continue;
-                        }
-                        if (is<Negation>(token)) {
-                                if (std::holds_alternative<Real::value_type>(val))
-                                        stack.push_back(make_operand<Real>(-std::get<Real::value_type>(val)));
-                                else if (std::holds_alternative<Integer::value_type>(val))
-                                        stack.push_back(make_operand<Integer>(-std::get<Integer::value_type>(val)));
-                                else
-                                        throw std::runtime_error("Error: unsupported operand");
-                                continue;
-                        }
-                        if (is<Not>(token)) {
-                                bool b{};
-                                if (std::holds_alternative<bool>(val))
-                                        b = std::get<bool>(val);
-                                else
-                                        throw std::runtime_error("Error: unsupported operand");
-                                stack.push_back(make_operand<Boolean>(!b));
-                                continue;
-                        }
+                if (is<Identity>(token)) {
+                        stack_m.push_back(operand);
+                        return ErrorCode::None;
+                }
+                if (is<Negation>(token)) {
+                        if (std::holds_alternative<Real::value_type>(val))
+                                stack_m.push_back(make_operand<Real>(-std::get<Real::value_type>(val)));
+                        else if (std::holds_alternative<Integer::value_type>(val))
+                                stack_m.push_back(make_operand<Integer>(-std::get<Integer::value_type>(val)));
+                        else
+                                return ErrorCode::UnsupportedOperand;
+                        return ErrorCode::None;
+                }
+                if (is<Not>(token)) {
+                        bool b{};
+                        if (std::holds_alternative<bool>(val))
+                                b = std::get<bool>(val);
+                        else
+                                return ErrorCode::UnsupportedOperand;
+                        stack_m.push_back(make_operand<Boolean>(!b));
+                        return ErrorCode::None;
                 }
+        }
 
-                // binary operators and functions
-                if (is<BinaryOperator>(token)) {
-                                if (stack.size() < 2)
-                                        throw std::runtime_error("Error: insufficient operands");
-                                auto rhsOp = stack.back(); stack.pop_back();
-                                auto lhsOp = stack.back(); stack.pop_back();
-                                Value rhs = to_value(rhsOp);
-                                Value lhs = to_value(lhsOp);
-
-                        if (is<Assignment>(token)) {
-                                if (!is<Variable>(lhsOp))
-                                        throw std::runtime_error("Error: assignment to a non-variable.");
-                                auto var = convert<Variable>(lhsOp);
-                                var->set(make_operand_from_value(rhs));
-                                stack.push_back(var);
-                                continue;
-                        }
+        // binary operators and functions
+        if (is<BinaryOperator>(token)) {
+                        if (stack_m.size() < 2)
+                                return ErrorCode::InsufficientOperands;
+                        auto rhsOp = stack_m.back(); stack_m.pop_back();
+                        auto lhsOp = stack_m.back(); stack_m.pop_back();
+                        GET_VALUE(rhs, rhsOp)
 
-                        auto [lProm, rProm] = promote(lhs, rhs);
+                // the target of an assignment is not read, so it may be uninitialized
+                if (is<Assignment>(token)) {
+                        if (!is<Variable>(lhsOp))
+                                return ErrorCode::AssignmentToNonVariable;
+                        auto var = convert<Variable>(lhsOp);
+                        var->set(make_operand_from_value(rhs));
+                        stack_m.push_back(var);
+                        return ErrorCode::None;
+                }
+                        GET_VALUE(lhs, lhsOp)
 
-                        auto make_bool = [&](bool value) { stack.push_back(make_operand<Boolean>(value)); };
-                        auto make_int = [&](Integer::value_type value) { stack.push_back(make_operand<Integer>(value)); };
-                        auto make_real = [&](Real::value_type value) { stack.push_back(make_operand<Real>(value)); };
+                auto [lProm, rProm] = promote(lhs, rhs);
 
-                        if (is<Addition>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_real(std::get<Real::value_type>(lProm) + std::get<Real::value_type>(rProm));
-                                else
-                                        make_int(std::get<Integer::value_type>(lProm) + std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<Subtraction>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_real(std::get<Real::value_type>(lProm) - std::get<Real::value_type>(rProm));
-                                else
-                                        make_int(std::get<Integer::value_type>(lProm) - std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<Multiplication>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_real(std::get<Real::value_type>(lProm) * std::get<Real::value_type>(rProm));
-                                else
-                                        make_int(std::get<Integer::value_type>(lProm) * std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<Division>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_real(std::get<Real::value_type>(lProm) / std::get<Real::value_type>(rProm));
-                                else
-                                        make_int(std::get<Integer::value_type>(lProm) / std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<Modulus>(token)) {
-                                make_int(std::get<Integer::value_type>(lProm) % std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<Power>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_real(pow(std::get<Real::value_type>(lProm), std::get<Real::value_type>(rProm)));
-                                else {
-                                        auto base = std::get<Integer::value_type>(lProm);
-                                        auto exp = std::get<Integer::value_type>(rProm);
-                                        Integer::value_type result = 1;
-                                        for (Integer::value_type i = 0; i < exp; ++i)
-                                                result *= base;
-                                        make_int(result);
+                auto make_bool = [&](bool value) { stack_m.push_back(make_operand<Boolean>(value)); };
+                auto make_int = [&](Integer::value_type value) { stack_m.push_back(make_operand<Integer>(value)); };
+                auto make_real = [&](Real::value_type value) { stack_m.push_back(make_operand<Real>(value)); };
+
+                if (is<Addition>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_real(std::get<Real::value_type>(lProm) + std::get<Real::value_type>(rProm));
+                        else
+                                make_int(std::get<Integer::value_type>(lProm) + std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Subtraction>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_real(std::get<Real::value_type>(lProm) - std::get<Real::value_type>(rProm));
+                        else
+                                make_int(std::get<Integer::value_type>(lProm) - std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Multiplication>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_real(std::get<Real::value_type>(lProm) * std::get<Real::value_type>(rProm));
+                        else
+                                make_int(std::get<Integer::value_type>(lProm) * std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Division>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_real(std::get<Real::value_type>(lProm) / std::get<Real::value_type>(rProm));
+                        else
+                                make_int(std::get<Integer::value_type>(lProm) / std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Modulus>(token)) {
+                        make_int(std::get<Integer::value_type>(lProm) % std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Power>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_real(pow(std::get<Real::value_type>(lProm), std::get<Real::value_type>(rProm)));
+                        else {
+                                auto base = std::get<Integer::value_type>(lProm);
+                                auto exp = std::get<Integer::value_type>(rProm);
+                                // refuse what can't fit before starting: the result has more than msb(|base|) * exp bits
+                                if (limits_m.maxSteps && exp > limits_m.maxSteps - std::min(steps_m, limits_m.maxSteps))
+                                        return ErrorCode::StepLimitExceeded;
+                                if (maxLimbs_m && exp > 0 && abs(base) > 1 && Integer::value_type(msb(abs(base))) * exp >= maxLimbs_m * 64)
+                                        return ErrorCode::DigitLimitExceeded;
+                                Integer::value_type result = 1;
+                                for (Integer::value_type i = 0; i < exp; ++i) {
+                                        if (auto const code = _checkpoint(); code != ErrorCode::None)
+                                                return code;
+                                        result *= base;
+                                        if (!_fits(result))
+                                                return ErrorCode::DigitLimitExceeded;
                                 }
-                                continue;
+                                make_int(result);
                         }
-                        if (is<Equality>(token)) { make_bool(lProm == rProm); continue; }
-                        if (is<Inequality>(token)) { make_bool(lProm != rProm); continue; }
-                        if (is<Less>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_bool(std::get<Real::value_type>(lProm) < std::get<Real::value_type>(rProm));
-                                else
-                                        make_bool(std::get<Integer::value_type>(lProm) < std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<LessEqual>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_bool(std::get<Real::value_type>(lProm) <= std::get<Real::value_type>(rProm));
-                                else
-                                        make_bool(std::get<Integer::value_type>(lProm) <= std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<Greater>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_bool(std::get<Real::value_type>(lProm) > std::get<Real::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Equality>(token)) { make_bool(lProm == rProm); return ErrorCode::None; }
+                if (is<Inequality>(token)) { make_bool(lProm != rProm); return ErrorCode::None; }
+                if (is<Less>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_bool(std::get<Real::value_type>(lProm) < std::get<Real::value_type>(rProm));
+                        else
+                                make_bool(std::get<Integer::value_type>(lProm) < std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<LessEqual>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_bool(std::get<Real::value_type>(lProm) <= std::get<Real::value_type>(rProm));
+                        else
+                                make_bool(std::get<Integer::value_type>(lProm) <= std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<Greater>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_bool(std::get<Real::value_type>(lProm) > std::get<Real::value_type>(rProm));
+                        else
+                                make_bool(std::get<Integer::value_type>(lProm) > std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<GreaterEqual>(token)) {
+                        if (std::holds_alternative<Real::value_type>(lProm))
+                                make_bool(std::get<Real::value_type>(lProm) >= std::get<Real::value_type>(rProm));
+                        else
+                                make_bool(std::get<Integer::value_type>(lProm) >= std::get<Integer::value_type>(rProm));
+                        return ErrorCode::None;
+                }
+                if (is<And>(token)) { make_bool(std::get<bool>(lhs) && std::get<bool>(rhs)); return ErrorCode::None; }
+                if (is<Or>(token)) { make_bool(std::get<bool>(lhs) || std::get<bool>(rhs)); return ErrorCode::None; }
+                if (is<Xor>(token)) { make_bool(std::get<bool>(lhs) ^ std::get<bool>(rhs)); return ErrorCode::None; }
+                if (is<Nand>(token)) { make_bool(!(std::get<bool>(lhs) && std::get<bool>(rhs))); return ErrorCode::None; }
+                if (is<Nor>(token)) { make_bool(!(std::get<bool>(lhs) || std::get<bool>(rhs))); return ErrorCode::None; }
+                if (is<Xnor>(token)) { make_bool(std::get<bool>(lhs) == std::get<bool>(rhs)); return ErrorCode::None; }
+        }
+
+        if (is<Function>(token)) {
+                if (is<OneArgFunction>(token)) {
+                        if (stack_m.size() < 1)
+                                return ErrorCode::InsufficientOperands;
+                        auto arg = stack_m.back(); stack_m.pop_back();
+                        GET_VALUE(v, arg)
+                        auto get_real = [&](Value const& val) { return std::holds_alternative<Real::value_type>(val) ? std::get<Real::value_type>(val) : Real::value_type(std::get<Integer::value_type>(val)); };
+                        // transcendental functions are pure and expensive: memoize them when a cache is in use
+                        auto transcendental = [&](auto fn) {
+                                Real::value_type x = get_real(v);
+                                if (functionCache_m)
+                                        stack_m.push_back(make_operand<Real>(functionCache_m->memoize(FunctionCache::make_key(*token, x), [&] { return Real::value_type(fn(x)); })));
                                 else
-                                        make_bool(std::get<Integer::value_type>(lProm) > std::get<Integer::value_type>(rProm));
-                                continue;
-                        }
-                        if (is<GreaterEqual>(token)) {
-                                if (std::holds_alternative<Real::value_type>(lProm))
-                                        make_bool(std::get<Real::value_type>(lProm) >= std::get<Real::value_type>(rProm));
+                                        stack_m.push_back(make_operand<Real>(fn(x)));
+                        };
+                        if (is<Abs>(token)) {
+                                if (std::holds_alternative<Real::value_type>(v))
+                                        stack_m.push_back(make_operand<Real>(abs(std::get<Real::value_type>(v))));
                                 else
-                                        make_bool(std::get<Integer::value_type>(lProm) >= std::get<Integer::value_type>(rProm));
-                                continue;
+                                        stack_m.push_back(make_operand<Integer>(abs(std::get<Integer::value_type>(v))));
+                        } else if (is<Sin>(token)) { transcendental([](Real::value_type const& x) { return sin(x); }); }
+                        else if (is<Cos>(token)) { transcendental([](Real::value_type const& x) { return cos(x); }); }
+                        else if (is<Tan>(token)) { transcendental([](Real::value_type const& x) { return tan(x); }); }
+                        else if (is<Sqrt>(token)) { transcendental([](Real::value_type const& x) { return sqrt(x); }); }
+                        else if (is<Ln>(token)) { transcendental([](Real::value_type const& x) { return log(x); }); }
+                        else if (is<Lb>(token)) { transcendental([](Real::value_type const& x) { return log2(x); }); }
+                        else if (is<Log>(token)) { transcendental([](Real::value_type const& x) { return log10(x); }); }
+                        else if (is<Exp>(token)) { transcendental([](Real::value_type const& x) { return exp(x); }); }
+                        else if (is<Floor>(token)) { stack_m.push_back(make_operand<Real>(floor(get_real(v)))); }
+                        else if (is<Ceil>(token)) { stack_m.push_back(make_operand<Real>(ceil(get_real(v)))); }
+                        else if (is<Arccos>(token)) { transcendental([](Real::value_type const& x) { return acos(x); }); }
+                        else if (is<Arcsin>(token)) { transcendental([](Real::value_type const& x) { return asin(x); }); }
+                        else if (is<Arctan>(token)) { transcendental([](Real::value_type const& x) { return atan(x); }); }
+                        else if (is<Result>(token)) {
+                                return ErrorCode::UnsupportedOperand;
                         }
-                        if (is<And>(token)) { make_bool(std::get<bool>(lhs) && std::get<bool>(rhs)); continue; }
-                        if (is<Or>(token)) { make_bool(std::get<bool>(lhs) || std::get<bool>(rhs)); continue; }
-                        if (is<Xor>(token)) { make_bool(std::get<bool>(lhs) ^ std::get<bool>(rhs)); continue; }
-                        if (is<Nand>(token)) { make_bool(!(std::get<bool>(lhs) && std::get<bool>(rhs))); continue; }
-                        if (is<Nor>(token)) { make_bool(!(std::get<bool>(lhs) || std::get<bool>(rhs))); continue; }
-                        if (is<Xnor>(token)) { make_bool(std::get<bool>(lhs) == std::get<bool>(rhs)); continue; }
+                        return ErrorCode::None;
                 }
 
-                if (is<Function>(token)) {
-                        if (is<OneArgFunction>(token)) {
-                                if (stack.size() < 1)
-                                        throw std::runtime_error("Error: insufficient operands");
-                                auto arg = stack.back(); stack.pop_back();
-                                Value v = to_value(arg);
-                                auto get_real = [&](Value const& val) { return std::holds_alternative<Real::value_type>(val) ? std::get<Real::value_type>(val) : Real::value_type(std::get<Integer::value_type>(val)); };
-                                if (is<Abs>(token)) {
-                                        if (std::holds_alternative<Real::value_type>(v))
-                                                stack.push_back(make_operand<Real>(abs(std::get<Real::value_type>(v))));
-                                        else
-                                                stack.push_back(make_operand<Integer>(abs(std::get<Integer::value_type>(v))));
-                                } else if (is<Sin>(token)) { stack.push_back(make_operand<Real>(sin(get_real(v)))); }
-                                else if (is<Cos>(token)) { stack.push_back(make_operand<Real>(cos(get_real(v)))); }
-                                else if (is<Tan>(token)) { stack.push_back(make_operand<Real>(tan(get_real(v)))); }
-                                else if (is<Sqrt>(token)) { stack.push_back(make_operand<Real>(sqrt(get_real(v)))); }
-                                else if (is<Ln>(token)) { stack.push_back(make_operand<Real>(log(get_real(v)))); }
-                                else if (is<Lb>(token)) { stack.push_back(make_operand<Real>(log2(get_real(v)))); }
-                                else if (is<Log>(token)) { stack.push_back(make_operand<Real>(log10(get_real(v)))); }
-                                else if (is<Exp>(token)) { stack.push_back(make_operand<Real>(exp(get_real(v)))); }
-                                else if (is<Floor>(token)) { stack.push_back(make_operand<Real>(floor(get_real(v)))); }
-                                else if (is<Ceil>(token)) { stack.push_back(make_operand<Real>(ceil(get_real(v)))); }
-                                else if (is<Arccos>(token)) { stack.push_back(make_operand<Real>(acos(get_real(v)))); }
-                                else if (is<Arcsin>(token)) { stack.push_back(make_operand<Real>(asin(get_real(v)))); }
-                                else if (is<Arctan>(token)) { stack.push_back(make_operand<Real>(atan(get_real(v)))); }
-                                else if (is<Result>(token)) {
-                                        throw std::runtime_error("Error: unsupported operand");
-                                }
-                                continue;
-                        }
-
-                        if (is<TwoArgFunction>(token)) {
-                                if (stack.size() < 2)
-                                        throw std::runtime_error("Error: insufficient operands");
-                                auto rhsOp = stack.back(); stack.pop_back();
-                                auto lhsOp = stack.back(); stack.pop_back();
-                                Value rhs = to_value(rhsOp);
-                                Value lhs = to_value(lhsOp);
-                                auto get_real = [&](Value const& val) { return std::holds_alternative<Real::value_type>(val) ? std::get<Real::value_type>(val) : Real::value_type(std::get<Integer::value_type>(val)); };
-                                if (is<Arctan2>(token)) { stack.push_back(make_operand<Real>(atan2(get_real(lhs), get_real(rhs)))); }
-                                else if (is<Max>(token)) { stack.push_back(make_operand<Real>(std::max(get_real(lhs), get_real(rhs)))); }
-                                else if (is<Min>(token)) { stack.push_back(make_operand<Real>(std::min(get_real(lhs), get_real(rhs)))); }
-                                else if (is<Pow>(token)) { stack.push_back(make_operand<Real>(pow(get_real(lhs), get_real(rhs)))); }
-                                continue;
-                        }
+                if (is<TwoArgFunction>(token)) {
+                        if (stack_m.size() < 2)
+                                return ErrorCode::InsufficientOperands;
+                        auto rhsOp = stack_m.back(); stack_m.pop_back();
+                        auto lhsOp = stack_m.back(); stack_m.pop_back();
+                        GET_VALUE(rhs, rhsOp)
+                        GET_VALUE(lhs, lhsOp)
+                        auto get_real = [&](Value const& val) { return std::holds_alternative<Real::value_type>(val) ? std::get<Real::value_type>(val) : Real::value_type(std::get<Integer::value_type>(val)); };
+                        auto transcendental = [&](auto fn) {
+                                Real::value_type x = get_real(lhs), y = get_real(rhs);
+                                if (functionCache_m)
+                                        stack_m.push_back(make_operand<Real>(functionCache_m->memoize(FunctionCache::make_key(*token, x, y), [&] { return Real::value_type(fn(x, y)); })));
+                                else
+                                        stack_m.push_back(make_operand<Real>(fn(x, y)));
+                        };
+                        if (is<Arctan2>(token)) { transcendental([](Real::value_type const& y, Real::value_type const& x) { return atan2(y, x); }); }
+                        else if (is<Max>(token)) { stack_m.push_back(make_operand<Real>(std::max(get_real(lhs), get_real(rhs)))); }
+                        else if (is<Min>(token)) { stack_m.push_back(make_operand<Real>(std::min(get_real(lhs), get_real(rhs)))); }
+                        else if (is<Pow>(token)) { transcendental([](Real::value_type const& x, Real::value_type const& y) { return pow(x, y); }); }
+                        return ErrorCode::None;
                 }
         }
 
-        if (stack.empty())
-                throw std::runtime_error("Error: insufficient operands");
-        if (stack.size() != 1)
-                throw std::runtime_error("Error: too many operands");
-        return stack.back();
+        return ErrorCode::UnsupportedOperand;
+}
+
+
+
+/*!	Ends the postfix expression.
+	@return the result, the single value left on the stack.
+	*/
+[[nodiscard]] Operand::pointer_type RPNEvaluator::finish() {
+        auto result = try_finish();
+        if (!result)
+                throw std::runtime_error(result.error().message());
+        return *result;
 }
 
+
+
+/*!	Ends the postfix expression without throwing.
+	@return the result, or the error (offset 0).
+	*/
+[[nodiscard]] Expected<Operand::pointer_type> RPNEvaluator::try_finish() {
+        if (stack_m.empty())
+                return Error{ ErrorCode::InsufficientOperands };
+        if (stack_m.size() != 1)
+                return Error{ ErrorCode::TooManyOperands };
+        auto result = stack_m.back();
+        stack_m.clear();
+        return result;
+}
@@ -0,0 +1,79 @@
+/*!	\file	ast.cpp
+	\brief	Ast class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/ast.hpp>
+#include <cassert>
+#include <utility>
+using namespace std;
+
+
+
+/*!	Adds a node.
+	@return the index of the new node.
+	@param kind [in] the node category.
+	@param token [in] the operand, operator, or function token.
+	@param span [in] the source text of the whole subexpression.
+	@param children [in] indices of the child nodes, in operand order; each must already be in the tree.
+	*/
+Ast::index_type Ast::add(Kind kind, Token::pointer_type const& token, Span span, std::span<index_type const> children) {
+	Node node;
+	node.kind = kind;
+	node.token = token;
+	node.span = span;
+	node.firstChild = index_type(children_m.size());
+	node.childCount = uint32_t(children.size());
+	for (auto child : children) {
+		assert(child < nodes_m.size() && "children must be added before their parent");
+		children_m.push_back(child);
+	}
+	nodes_m.push_back(move(node));
+	return index_type(nodes_m.size() - 1);
+}
+
+
+
+/*!	Converts the tree to the postfix expression Parser::parse() would produce.
+	Linear in the number of nodes (iterative post-order walk from the root).
+	*/
+[[nodiscard]] TokenList Ast::to_rpn() const {
+	TokenList rpn;
+	if (nodes_m.empty())
+		return rpn;
+
+	rpn.reserve(nodes_m.size());
+	vector<pair<index_type, uint32_t>> pending{ { root(), 0 } };
+	while (!pending.empty()) {
+		auto& [index, nextChild] = pending.back();
+		auto const& node = nodes_m[index];
+		if (nextChild < node.childCount)
+			pending.emplace_back(children_m[node.firstChild + nextChild++], 0);
+		else {
+			rpn.push_back(node.token);
+			pending.pop_back();
+		}
+	}
+	return rpn;
+}
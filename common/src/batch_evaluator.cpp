@@ -0,0 +1,259 @@
+/*!	\file	batch_evaluator.cpp
+	\brief	BatchEvaluator class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+	Added stream() and row_source()
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/batch_evaluator.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/real.hpp>
+#include <algorithm>
+#include <istream>
+#include <stdexcept>
+#include <string>
+
+
+
+/*! Gets the value of an evaluation result, dereferencing variables so the result can't change afterwards. */
+[[nodiscard]] static Operand::pointer_type snapshot(Operand::pointer_type const& result) {
+	if (is<Variable>(result))
+		return convert<Variable>(result)->value();
+	return result;
+}
+
+
+
+namespace {
+	/*! Sets the row variables for the lifetime of the binding, then restores their previous values. */
+	class RowBinding {
+		BatchEvaluator::variable_list_type const&	variables_m;
+		BatchEvaluator::row_type					saved_m;
+	public:
+		explicit RowBinding(BatchEvaluator::variable_list_type const& variables) : variables_m(variables) {
+			for (auto const& v : variables_m)
+				saved_m.push_back(v->value());
+		}
+		~RowBinding() {
+			for (std::size_t i = 0; i < variables_m.size(); ++i)
+				variables_m[i]->set(saved_m[i]);
+		}
+
+		void bind(BatchEvaluator::row_type const& row) const {
+			if (row.size() != variables_m.size())
+				throw std::runtime_error("Error: row has the wrong number of values");
+			for (std::size_t i = 0; i < row.size(); ++i)
+				variables_m[i]->set(row[i]);
+		}
+
+		RowBinding(RowBinding const&) = delete;
+		RowBinding& operator = (RowBinding const&) = delete;
+	};
+
+	/*! Converts one field of a text row to an Integer, or failing that a Real. */
+	[[nodiscard]] Operand::pointer_type parse_field(std::string const& field) {
+		std::size_t const digits = field.front() == '-' || field.front() == '+' ? 1 : 0;
+		try {
+			if (field.size() > digits && field.find_first_not_of("0123456789", digits) == std::string::npos)
+				return make_operand<Integer>(Integer::value_type(field.substr(field.front() == '+' ? 1 : 0)));
+			return make_operand<Real>(Real::value_type(field));
+		}
+		catch (std::exception const&) {
+			throw std::runtime_error("Error: not a number: " + field);
+		}
+	}
+}
+
+
+
+/*!	Compiles the RPN expression for batch evaluation.
+	@param rpnExpression [in] the postfix expression.
+	@param varying [in] the variables whose values are supplied by each row.
+	@note Variables assigned by the expression are also treated as varying.
+	*/
+BatchEvaluator::BatchEvaluator(TokenList const& rpnExpression, variable_list_type const& varying)
+	: program_m(rpnExpression)
+	, varying_m(varying)
+{
+	std::size_t const n = program_m.size();
+	std::size_t const noParent = n;
+
+	// rebuild the tree shape: the first token and the parent of every subexpression
+	std::vector<std::size_t> start(n), parent(n, noParent);
+	std::vector<std::size_t> roots;
+	std::vector<Token const*> varyingVariables;
+	for (auto const& v : varying_m)
+		varyingVariables.push_back(v.get());
+
+	for (std::size_t i = 0; i < n; ++i) {
+		auto const& token = program_m[i];
+		start[i] = i;
+		if (is<Operation>(token)) {
+			auto const nArgs = convert<Operation>(token)->number_of_args();
+			if (roots.size() < nArgs)
+				throw std::runtime_error("Error: insufficient operands");
+			for (unsigned arg = 0; arg < nArgs; ++arg) {
+				parent[roots.back()] = i;
+				start[i] = start[roots.back()];
+				roots.pop_back();
+			}
+			// an assigned variable changes during evaluation, so it can't be hoisted
+			if (is<Assignment>(token) && is<Variable>(program_m[start[i]]))
+				varyingVariables.push_back(program_m[start[i]].get());
+		}
+		roots.push_back(i);
+	}
+
+	// classify each subexpression, children are always visited before their parent
+	std::vector<bool> uniform(n, true);
+	for (std::size_t i = 0; i < n; ++i) {
+		auto const& token = program_m[i];
+		if (is<Variable>(token))
+			uniform[i] = uniform[i] && std::find(varyingVariables.begin(), varyingVariables.end(), token.get()) == varyingVariables.end();
+		else if (is<Assignment>(token) || is<Result>(token) || !(is<Operand>(token) || is<Operation>(token)))
+			uniform[i] = false;
+
+		if (parent[i] != noParent && !uniform[i])
+			uniform[parent[i]] = false;
+	}
+
+	// hoist the maximal uniform operations
+	for (std::size_t i = 0; i < n; ++i)
+		if (uniform[i] && is<Operation>(program_m[i]) && (parent[i] == noParent || !uniform[parent[i]]))
+			hoists_m.push_back(Hoist{ start[i], i + 1 });
+}
+
+
+
+/*!	Gets the number of tokens executed for each row. */
+[[nodiscard]] std::size_t BatchEvaluator::row_program_size() const {
+	std::size_t size = program_m.size();
+	for (auto const& hoist : hoists_m)
+		size -= hoist.end - hoist.begin - 1;
+	return size;
+}
+
+
+
+/*!	Evaluates the uniform subexpressions and builds the per-row program with their values in place. */
+[[nodiscard]] TokenList BatchEvaluator::_bind_uniforms() const {
+	RPNEvaluator rpn;
+	TokenList rowProgram;
+	rowProgram.reserve(row_program_size());
+
+	std::size_t next = 0;
+	for (auto const& hoist : hoists_m) {
+		rowProgram.insert(rowProgram.end(), program_m.begin() + next, program_m.begin() + hoist.begin);
+		auto value = snapshot(rpn.evaluate(TokenList(program_m.begin() + hoist.begin, program_m.begin() + hoist.end)));
+		rowProgram.push_back(value);
+		next = hoist.end;
+	}
+	rowProgram.insert(rowProgram.end(), program_m.begin() + next, program_m.end());
+	return rowProgram;
+}
+
+
+
+/*!	Evaluates the expression for each row.
+	@return the value of the expression for each row, in row order.
+	@param rows [in] the values of the varying variables, one row per evaluation.
+	@note The varying variables are restored to their previous values afterwards.
+	*/
+[[nodiscard]] BatchEvaluator::result_list_type BatchEvaluator::evaluate(row_list_type const& rows) const {
+	result_list_type results;
+	if (rows.empty())
+		return results;
+	results.reserve(rows.size());
+
+	TokenList const rowProgram = _bind_uniforms();
+	RowBinding binding(varying_m);
+	RPNEvaluator rpn;
+	for (auto const& row : rows) {
+		binding.bind(row);
+		results.push_back(snapshot(rpn.evaluate(rowProgram)));
+	}
+	return results;
+}
+
+
+
+/*!	Evaluates the expression for each row supplied by 'next', one block of rows at a time.
+	@return a generator of the values of the expression, in row order.
+	@param next [in] the row source, called until it returns false.
+	@param blockSize [in] the number of rows evaluated between reads of the source.
+	@note The row variables are restored after each block, so they have their previous values while the consumer runs.
+	*/
+[[nodiscard]] Generator<Operand::pointer_type> BatchEvaluator::stream(row_source_type next, std::size_t blockSize) const {
+	blockSize = std::max<std::size_t>(blockSize, 1);
+	TokenList const rowProgram = _bind_uniforms();
+	RPNEvaluator rpn;
+
+	// the rows and results are reused by every block
+	row_list_type block(blockSize);
+	result_list_type results;
+	results.reserve(blockSize);
+
+	for (bool more = true; more; ) {
+		std::size_t count = 0;
+		while (count < blockSize && (more = next(block[count])))
+			++count;
+
+		results.clear();
+		{
+			RowBinding binding(varying_m);
+			for (std::size_t i = 0; i < count; ++i) {
+				binding.bind(block[i]);
+				results.push_back(snapshot(rpn.evaluate(rowProgram)));
+			}
+		}
+		for (auto const& result : results)
+			co_yield result;
+	}
+}
+
+
+
+/*!	Gets a row source over the lines of a text stream.
+	@return a source that reads 'in' one line per row.
+	@param in [in] the stream, which must outlive the source.
+	*/
+[[nodiscard]] BatchEvaluator::row_source_type BatchEvaluator::row_source(std::istream& in) {
+	return [&in](row_type& row) {
+		std::string line;
+		while (std::getline(in, line)) {
+			row.clear();
+			std::size_t pos = 0;
+			while ((pos = line.find_first_not_of(" \t\r,", pos)) != std::string::npos) {
+				std::size_t const end = line.find_first_of(" \t\r,", pos);
+				row.push_back(parse_field(line.substr(pos, end - pos)));
+				pos = end;
+			}
+			if (!row.empty())
+				return true;
+		}
+		return false;
+	};
+}
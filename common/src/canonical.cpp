@@ -0,0 +1,318 @@
+/*!	\file	canonical.cpp
+	\brief	Expression canonicalization and structural hashing implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/canonical.hpp>
+#include <ee/boolean.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ios>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+using namespace std;
+
+
+
+// ----------------------------------------------------------------------------
+// Hash128 / Hasher128
+// ----------------------------------------------------------------------------
+
+/*! Formats the hash as 32 hexadecimal digits. */
+[[nodiscard]] string Hash128::str() const {
+	ostringstream oss;
+	oss << hex << setfill('0') << setw(16) << high << setw(16) << low;
+	return oss.str();
+}
+
+
+
+namespace {
+	[[nodiscard]] constexpr uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+	/*! 64-bit finalizer (MurmurHash3 fmix64). */
+	[[nodiscard]] constexpr uint64_t fmix(uint64_t x) {
+		x ^= x >> 33;
+		x *= 0xFF51AFD7ED558CCDull;
+		x ^= x >> 33;
+		x *= 0xC4CEB9FE1A85EC53ull;
+		x ^= x >> 33;
+		return x;
+	}
+}
+
+
+
+/*! Adds a block of bytes to the hash. */
+Hasher128& Hasher128::update(void const* data, size_t size) {
+	auto mix = [this](uint64_t word) {
+		lane1_m = rotl(lane1_m ^ (word * 0x87C37B91114253D5ull), 31) * 0x4CF5AD432745937Full;
+		lane2_m = rotl(lane2_m ^ (word * 0x4CF5AD432745937Full), 33) * 0x87C37B91114253D5ull + lane1_m;
+	};
+
+	auto bytes = static_cast<unsigned char const*>(data);
+	length_m += size;
+	for (; size >= sizeof(uint64_t); bytes += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+		uint64_t word;
+		memcpy(&word, bytes, sizeof(word));
+		mix(word);
+	}
+	if (size > 0) {
+		uint64_t word = 0;
+		memcpy(&word, bytes, size);
+		mix(word ^ (uint64_t(size) << 56));
+	}
+	return *this;
+}
+
+
+
+/*! Gets the hash of everything added so far. */
+[[nodiscard]] Hash128 Hasher128::digest() const {
+	uint64_t a = lane1_m ^ length_m;
+	uint64_t b = lane2_m ^ rotl(length_m, 32);
+	a += b;
+	b += a;
+	a = fmix(a);
+	b = fmix(b);
+	a += b;
+	b += a;
+	return Hash128{ a, b };
+}
+
+
+
+// ----------------------------------------------------------------------------
+// token_tag
+// ----------------------------------------------------------------------------
+
+namespace {
+	template <typename T> [[nodiscard]] bool is_a(Token const* token) { return is<T>(token); }
+
+	/*! Tag of each concrete token type; subclasses are listed before their base classes. */
+	struct TokenTag {
+		bool		(*test)(Token const*);
+		string		tag;
+	};
+
+	TokenTag const tokenTags_c[] = {
+		{ is_a<True>, "True" },
+		{ is_a<False>, "False" },
+		{ is_a<Boolean>, "Boolean" },
+		{ is_a<Integer>, "Integer" },
+		{ is_a<Pi>, "Pi" },
+		{ is_a<E>, "E" },
+		{ is_a<Real>, "Real" },
+		{ is_a<Variable>, "Variable" },
+		{ is_a<Abs>, "Abs" },
+		{ is_a<Arccos>, "Arccos" },
+		{ is_a<Arcsin>, "Arcsin" },
+		{ is_a<Arctan>, "Arctan" },
+		{ is_a<Arctan2>, "Arctan2" },
+		{ is_a<Ceil>, "Ceil" },
+		{ is_a<Cos>, "Cos" },
+		{ is_a<Exp>, "Exp" },
+		{ is_a<Floor>, "Floor" },
+		{ is_a<Lb>, "Lb" },
+		{ is_a<Ln>, "Ln" },
+		{ is_a<Log>, "Log" },
+		{ is_a<Result>, "Result" },
+		{ is_a<Sin>, "Sin" },
+		{ is_a<Sqrt>, "Sqrt" },
+		{ is_a<Tan>, "Tan" },
+		{ is_a<Max>, "Max" },
+		{ is_a<Min>, "Min" },
+		{ is_a<Pow>, "Pow" },
+		{ is_a<Power>, "Power" },
+		{ is_a<Assignment>, "Assignment" },
+		{ is_a<Addition>, "Addition" },
+		{ is_a<And>, "And" },
+		{ is_a<Division>, "Division" },
+		{ is_a<Equality>, "Equality" },
+		{ is_a<Greater>, "Greater" },
+		{ is_a<GreaterEqual>, "GreaterEqual" },
+		{ is_a<Inequality>, "Inequality" },
+		{ is_a<Less>, "Less" },
+		{ is_a<LessEqual>, "LessEqual" },
+		{ is_a<Multiplication>, "Multiplication" },
+		{ is_a<Modulus>, "Modulus" },
+		{ is_a<Nand>, "Nand" },
+		{ is_a<Nor>, "Nor" },
+		{ is_a<Or>, "Or" },
+		{ is_a<Subtraction>, "Subtraction" },
+		{ is_a<Xor>, "Xor" },
+		{ is_a<Xnor>, "Xnor" },
+		{ is_a<Identity>, "Identity" },
+		{ is_a<Negation>, "Negation" },
+		{ is_a<Not>, "Not" },
+		{ is_a<Factorial>, "Factorial" },
+		{ is_a<LeftParenthesis>, "LeftParenthesis" },
+		{ is_a<RightParenthesis>, "RightParenthesis" },
+		{ is_a<ArgumentSeparator>, "ArgumentSeparator" },
+	};
+}
+
+
+
+/*!	Gets a fixed tag naming the concrete type of a token.
+	@return the token's class name, independent of the compiler's typeid() spelling.
+	@throw logic_error if the token type has no tag.
+	*/
+[[nodiscard]] string const& token_tag(Token const& token) {
+	for (auto const& entry : tokenTags_c)
+		if (entry.test(&token))
+			return entry.tag;
+	throw logic_error("Error: no tag for token type");
+}
+
+
+
+/*!	Gets the exact text of an operand's value.
+	@return a Real in scientific notation with max_digits10 digits, an Integer's digits, or Token::str() for other tokens.
+	*/
+[[nodiscard]] string exact_str(Token const& operand) {
+	if (auto real = dynamic_cast<Real const*>(&operand))
+		return real->value().str(numeric_limits<Real::value_type>::max_digits10, ios_base::scientific);
+	if (auto integer = dynamic_cast<Integer const*>(&operand))
+		return integer->value().str();
+	return operand.str();
+}
+
+
+
+// ----------------------------------------------------------------------------
+// canonicalize
+// ----------------------------------------------------------------------------
+
+namespace {
+	/*! Expression tree node rebuilt from the postfix expression. */
+	struct Node {
+		Token::pointer_type		token;
+		vector<size_t>			children;
+		Hash128					hash;
+		bool					hasSideEffect = false;
+	};
+
+
+	/*! Operations whose operands may be reordered without changing the result. */
+	[[nodiscard]] bool is_commutative(Token::pointer_type const& token) {
+		return is<Addition>(token) || is<Multiplication>(token)
+			|| is<And>(token) || is<Or>(token) || is<Xor>(token)
+			|| is<Nand>(token) || is<Nor>(token) || is<Xnor>(token)
+			|| is<Equality>(token) || is<Inequality>(token)
+			|| is<Max>(token) || is<Min>(token);
+	}
+
+
+	/*! Adds the literal value of an operand to the hash. */
+	void hash_literal(Hasher128& hasher, Token::pointer_type const& token) {
+		if (is<Variable>(token)) {
+			auto const& name = convert<Variable>(token)->name();
+			if (!name.empty())
+				hasher.update(name);
+			else
+				hasher.update(uint64_t(reinterpret_cast<uintptr_t>(token.get())));
+		}
+		else if (is<Boolean>(token))
+			hasher.update(uint64_t(value_of<Boolean>(token)));
+		else if (is<Integer>(token) || is<Real>(token))
+			hasher.update(exact_str(*token));
+	}
+}
+
+
+
+/*!	Canonicalizes a postfix expression.
+	@return the canonically ordered postfix expression and its structural hash.
+	@param rpnExpression [in] the postfix expression from Parser::parse().
+	@note Operands that contain an assignment are not reordered, to preserve the order of side effects.
+	*/
+[[nodiscard]] CanonicalForm canonicalize(TokenList const& rpnExpression) {
+	vector<Node> nodes;
+	nodes.reserve(rpnExpression.size());
+	vector<size_t> roots;
+
+	// rebuild the tree bottom-up, ordering the operands of commutative operations by hash
+	for (auto const& token : rpnExpression) {
+		Node node;
+		node.token = token;
+
+		if (is<Operation>(token)) {
+			auto const nArgs = convert<Operation>(token)->number_of_args();
+			if (roots.size() < nArgs)
+				throw runtime_error("Error: insufficient operands");
+			node.children.assign(roots.end() - nArgs, roots.end());
+			roots.resize(roots.size() - nArgs);
+			node.hasSideEffect = is<Assignment>(token) || is<Result>(token);
+			for (auto child : node.children)
+				node.hasSideEffect = node.hasSideEffect || nodes[child].hasSideEffect;
+
+			if (is_commutative(token) && !node.hasSideEffect)
+				stable_sort(node.children.begin(), node.children.end(), [&](size_t lhs, size_t rhs) { return nodes[lhs].hash < nodes[rhs].hash; });
+		}
+
+		Hasher128 hasher;
+		hasher.update(token_tag(*token));
+		hash_literal(hasher, token);
+		hasher.update(uint64_t(node.children.size()));
+		for (auto child : node.children)
+			hasher.update(nodes[child].hash);
+		node.hash = hasher.digest();
+
+		roots.push_back(nodes.size());
+		nodes.push_back(move(node));
+	}
+
+	if (roots.empty())
+		throw runtime_error("Error: insufficient operands");
+	if (roots.size() != 1)
+		throw runtime_error("Error: too many operands");
+
+	// emit the canonical postfix expression (iterative post-order walk)
+	CanonicalForm form;
+	form.hash = nodes[roots.back()].hash;
+	form.rpn.reserve(nodes.size());
+	vector<pair<size_t, size_t>> pending{ { roots.back(), 0 } };
+	while (!pending.empty()) {
+		auto& [index, nextChild] = pending.back();
+		auto const& node = nodes[index];
+		if (nextChild < node.children.size())
+			pending.emplace_back(node.children[nextChild++], 0);
+		else {
+			form.rpn.push_back(node.token);
+			pending.pop_back();
+		}
+	}
+	return form;
+}
@@ -0,0 +1,137 @@
+/*!	\file	char_scan.cpp
+	\brief	Character run scanners implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/char_scan.hpp>
+#include <bit>
+
+#if defined(__AVX2__)
+	#define EE_SCAN_AVX2 1
+	#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define EE_SCAN_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+
+
+namespace {
+	/*	Each class test returns a byte mask: 0xFF where the byte is in the class.
+		The signed compares put bytes >= 0x80 below every bound, so they are never in a class.
+		*/
+#if EE_SCAN_SSE2
+	struct Sse2 {
+		using vector_type = __m128i;
+		static constexpr std::ptrdiff_t width_c = 16;
+
+		[[nodiscard]] static vector_type load(char const* p) { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)); }
+		[[nodiscard]] static vector_type in_range(vector_type v, char low, char high) {
+			return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(char(low - 1))), _mm_cmplt_epi8(v, _mm_set1_epi8(char(high + 1))));
+		}
+		[[nodiscard]] static vector_type space(vector_type v) { return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), in_range(v, '\t', '\r')); }
+		[[nodiscard]] static vector_type digit(vector_type v) { return in_range(v, '0', '9'); }
+		[[nodiscard]] static vector_type alnum(vector_type v) {
+			return _mm_or_si128(digit(v), in_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z'));	// 0x20 folds A-Z onto a-z
+		}
+		/*! Bit i set where byte i is outside the class. */
+		[[nodiscard]] static unsigned outside(vector_type inClass) { return ~unsigned(_mm_movemask_epi8(inClass)) & 0xFFFFu; }
+	};
+#endif
+
+#if EE_SCAN_AVX2
+	struct Avx2 {
+		using vector_type = __m256i;
+		static constexpr std::ptrdiff_t width_c = 32;
+
+		[[nodiscard]] static vector_type load(char const* p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)); }
+		[[nodiscard]] static vector_type in_range(vector_type v, char low, char high) {
+			return _mm256_andnot_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(high)), _mm256_cmpgt_epi8(v, _mm256_set1_epi8(char(low - 1))));
+		}
+		[[nodiscard]] static vector_type space(vector_type v) { return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), in_range(v, '\t', '\r')); }
+		[[nodiscard]] static vector_type digit(vector_type v) { return in_range(v, '0', '9'); }
+		[[nodiscard]] static vector_type alnum(vector_type v) {
+			return _mm256_or_si256(digit(v), in_range(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z'));
+		}
+		[[nodiscard]] static unsigned outside(vector_type inClass) { return ~unsigned(_mm256_movemask_epi8(inClass)); }
+	};
+#endif
+
+	enum class Run { Space, Digit, Alnum };
+
+	/*! Scans whole vectors while they are entirely in the class; stops at the first vector that isn't, or the last whole vector. */
+	template <typename ISA, Run RUN>
+	[[nodiscard]] inline char const* vector_run_end(char const*& first, char const* last) {
+		for (; last - first >= ISA::width_c; first += ISA::width_c) {
+			auto const v = ISA::load(first);
+			unsigned mask;
+			if constexpr (RUN == Run::Space)
+				mask = ISA::outside(ISA::space(v));
+			else if constexpr (RUN == Run::Digit)
+				mask = ISA::outside(ISA::digit(v));
+			else
+				mask = ISA::outside(ISA::alnum(v));
+			if (mask != 0)
+				return first + std::countr_zero(mask);
+		}
+		return nullptr;
+	}
+
+	template <Run RUN>
+	[[nodiscard]] char const* run_end(char const* first, char const* last) {
+#if EE_SCAN_AVX2
+		if (auto end = vector_run_end<Avx2, RUN>(first, last))
+			return end;
+#endif
+#if EE_SCAN_SSE2
+		if (auto end = vector_run_end<Sse2, RUN>(first, last))
+			return end;
+#endif
+		if constexpr (RUN == Run::Space)
+			return space_run_end_scalar(first, last);
+		else if constexpr (RUN == Run::Digit)
+			return digit_run_end_scalar(first, last);
+		else
+			return alnum_run_end_scalar(first, last);
+	}
+}
+
+
+
+[[nodiscard]] char const* space_run_end(char const* first, char const* last) { return run_end<Run::Space>(first, last); }
+[[nodiscard]] char const* digit_run_end(char const* first, char const* last) { return run_end<Run::Digit>(first, last); }
+[[nodiscard]] char const* alnum_run_end(char const* first, char const* last) { return run_end<Run::Alnum>(first, last); }
+
+
+
+[[nodiscard]] char const* char_scan_instruction_set() {
+#if EE_SCAN_AVX2
+	return "AVX2";
+#elif EE_SCAN_SSE2
+	return "SSE2";
+#else
+	return "scalar";
+#endif
+}
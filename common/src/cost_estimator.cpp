@@ -0,0 +1,304 @@
+/*!	\file	cost_estimator.cpp
+	\brief	CostEstimator class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/cost_estimator.hpp>
+#include <ee/boolean.hpp>
+#include <ee/function.hpp>
+#include <ee/integer.hpp>
+#include <ee/operator.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	constexpr double integer_limb_digits_c = 19.0;	/// decimal digits per 64-bit limb of an Integer.
+	constexpr double real_limb_digits_c = 8.0;		/// decimal digits per limb of a Real.
+	constexpr double reference_digits_c = 1000.0;	/// the precision the function costs were measured at.
+	constexpr double max_known_c = 1e15;			/// larger values are tracked by their digits only.
+
+	/*! What is known about a value before it is computed. */
+	struct Bound {
+		enum class Kind { Integer, Real, Boolean };
+
+		Kind				kind = Kind::Integer;
+		double				digits = 1.0;		/// decimal digits in the integer part, at most.
+		optional<double>	value;				/// the value, if it is known and small.
+	};
+
+	[[nodiscard]] double saturate(double x) {
+		return isnan(x) ? CostEstimator::max_units_c : min(x, CostEstimator::max_units_c);
+	}
+
+	[[nodiscard]] double limbs(double digits) {
+		return max(1.0, ceil(digits / integer_limb_digits_c));
+	}
+
+	[[nodiscard]] double digits_of(double magnitude) {
+		magnitude = fabs(magnitude);
+		if (!isfinite(magnitude))
+			return CostEstimator::max_units_c;
+		return magnitude < 10.0 ? 1.0 : floor(log10(magnitude)) + 1.0;
+	}
+
+	/*! Keeps a computed value only while it is small enough to be exact. */
+	[[nodiscard]] optional<double> known(double value) {
+		return isfinite(value) && fabs(value) < max_known_c ? optional<double>(value) : nullopt;
+	}
+
+	/*! The largest value a bound allows: its value, or else the largest number of its digits. */
+	[[nodiscard]] double largest(Bound const& bound) {
+		return bound.value ? fabs(*bound.value) : pow(10.0, bound.digits);
+	}
+
+	constexpr double pow_factor_c = 7'700;
+
+	/*! The cost of a transcendental function, in real multiplications at 1000 digits (measured, rounded). */
+	[[nodiscard]] double transcendental_factor(Token const* token) {
+		if (is<Sqrt>(token))	return 10;
+		if (is<Exp>(token))		return 300;
+		if (is<Sin>(token))		return 800;
+		if (is<Cos>(token))		return 1'200;
+		if (is<Tan>(token))		return 2'600;
+		if (is<Pow>(token))		return pow_factor_c;
+		if (is<Arctan>(token))	return 12'000;
+		if (is<Ln>(token))		return 13'000;
+		if (is<Lb>(token))		return 13'000;
+		if (is<Arcsin>(token))	return 18'000;
+		if (is<Arccos>(token))	return 18'000;
+		if (is<Arctan2>(token))	return 18'000;
+		if (is<Log>(token))		return 20'000;
+		return 0;
+	}
+}
+
+
+
+CostEstimator::CostEstimator(unsigned realDigits, lookup_type lookup)
+	: realDigits_m(realDigits ? double(realDigits) : double(numeric_limits<Real::value_type>::digits10))
+	, lookup_m(move(lookup))
+{ }
+
+
+
+/*!	Estimates the cost of evaluating a postfix expression.
+	@param rpnExpression [in] the postfix expression from Parser::parse().
+	*/
+[[nodiscard]] CostEstimate CostEstimator::estimate(TokenList const& rpnExpression) const {
+	using Kind = Bound::Kind;
+	CostEstimate estimate;
+	vector<Bound> stack;
+
+	double const realLimbs = max(1.0, ceil(realDigits_m / real_limb_digits_c));
+	double const realMultiply = realLimbs * realLimbs;
+	double const functionScale = realMultiply * realDigits_m / reference_digits_c;
+
+	auto const unknown = [&] {
+		estimate.bounded = false;
+		return Bound{ Kind::Integer, unknown_digits_c, nullopt };
+	};
+	auto const pop = [&] {
+		if (stack.empty())
+			return unknown();
+		auto bound = stack.back();
+		stack.pop_back();
+		return bound;
+	};
+	auto const charge = [&](double units) { estimate.units = saturate(estimate.units + units); };
+
+	// the bound of a literal or variable
+	auto const bound_of = [&](Operand::pointer_type operand) {
+		if (is<Variable>(operand)) {
+			operand = lookup_m ? lookup_m(*operand) : convert<Variable>(operand)->value();
+			if (is<Variable>(operand))
+				operand = convert<Variable>(operand)->value();
+		}
+		if (is<Integer>(operand)) {
+			auto const& value = value_of<Integer>(operand);
+			double const digits = value == 0 ? 1.0 : floor(double(msb(abs(value))) * log10(2.0)) + 1.0;
+			return Bound{ Kind::Integer, digits, digits < 16.0 ? known(value.convert_to<double>()) : nullopt };
+		}
+		if (is<Real>(operand)) {
+			double const value = value_of<Real>(operand).convert_to<double>();
+			return Bound{ Kind::Real, digits_of(value), known(value) };
+		}
+		if (is<Boolean>(operand))
+			return Bound{ Kind::Boolean, 1.0, nullopt };
+		return unknown();
+	};
+
+	for (auto const& token : rpnExpression) {
+		if (is<Operand>(token)) {
+			stack.push_back(bound_of(convert<Operand>(token)));
+			continue;
+		}
+		if (!is<Operation>(token))
+			continue;
+		++estimate.steps;
+
+		// the factorial loop: n multiplications by a small factor, of an accumulator growing to log10(n!) digits
+		if (is<PostfixOperator>(token)) {
+			auto const n = pop();
+			double const count = n.value ? max(0.0, *n.value) : pow(10.0, n.digits);
+			double const digits = count < 2.0 ? 1.0 : floor(lgamma(count + 1.0) / log(10.0)) + 1.0;
+			charge(count * limbs(digits) / 2.0 + count);
+			stack.push_back(Bound{ Kind::Integer, digits, n.value ? known(tgamma(count + 1.0)) : nullopt });
+			continue;
+		}
+
+		if (is<UnaryOperator>(token)) {
+			auto bound = pop();
+			if (is<Negation>(token)) {
+				charge(bound.kind == Kind::Real ? realLimbs : limbs(bound.digits));
+				if (bound.value)
+					bound.value = -*bound.value;
+			}
+			else if (is<Not>(token))
+				charge(1.0);
+			stack.push_back(bound);
+			continue;
+		}
+
+		if (is<BinaryOperator>(token)) {
+			auto const rhs = pop();
+			auto const lhs = pop();
+			if (is<Assignment>(token)) {
+				charge(1.0);
+				stack.push_back(rhs);
+				continue;
+			}
+
+			bool const real = lhs.kind == Kind::Real || rhs.kind == Kind::Real;
+			Kind const kind = real ? Kind::Real : Kind::Integer;
+			bool const bothKnown = lhs.value && rhs.value;
+			double const integerProduct = limbs(lhs.digits) * limbs(rhs.digits);
+
+			if (is<Addition>(token) || is<Subtraction>(token)) {
+				charge(real ? realLimbs : max(limbs(lhs.digits), limbs(rhs.digits)));
+				auto const value = bothKnown ? known(is<Addition>(token) ? *lhs.value + *rhs.value : *lhs.value - *rhs.value) : nullopt;
+				stack.push_back(Bound{ kind, max(lhs.digits, rhs.digits) + 1.0, value });
+			}
+			else if (is<Multiplication>(token)) {
+				charge(real ? realMultiply : integerProduct);
+				stack.push_back(Bound{ kind, lhs.digits + rhs.digits, bothKnown ? known(*lhs.value * *rhs.value) : nullopt });
+			}
+			else if (is<Division>(token)) {
+				charge(real ? 5.0 * realMultiply : integerProduct);
+				optional<double> value;
+				if (bothKnown && *rhs.value != 0.0)
+					value = known(real ? *lhs.value / *rhs.value : trunc(*lhs.value / *rhs.value));
+				stack.push_back(Bound{ kind, real ? lhs.digits : max(1.0, lhs.digits - rhs.digits + 1.0), value });
+			}
+			else if (is<Modulus>(token)) {
+				charge(integerProduct);
+				optional<double> value;
+				if (bothKnown && *rhs.value != 0.0)
+					value = known(fmod(*lhs.value, *rhs.value));
+				stack.push_back(Bound{ Kind::Integer, rhs.digits, value });
+			}
+			else if (is<Power>(token)) {
+				// reals use pow(); integers multiply the base in a loop, once per unit of the exponent
+				double const exponent = largest(rhs);
+				double const digits = max(1.0, lhs.digits * exponent);
+				if (real)
+					charge(pow_factor_c * functionScale);
+				else
+					charge(exponent * limbs(lhs.digits) * limbs(digits) / 2.0 + exponent);
+				stack.push_back(Bound{ kind, digits, bothKnown ? known(pow(*lhs.value, *rhs.value)) : nullopt });
+			}
+			else if (is<And>(token) || is<Or>(token) || is<Xor>(token) || is<Nand>(token) || is<Nor>(token) || is<Xnor>(token)) {
+				charge(1.0);
+				stack.push_back(Bound{ Kind::Boolean, 1.0, nullopt });
+			}
+			else {		// comparisons
+				charge(real ? realLimbs : max(limbs(lhs.digits), limbs(rhs.digits)));
+				stack.push_back(Bound{ Kind::Boolean, 1.0, nullopt });
+			}
+			continue;
+		}
+
+		if (is<OneArgFunction>(token)) {
+			auto bound = pop();
+			if (is<Abs>(token)) {
+				charge(bound.kind == Kind::Real ? realLimbs : limbs(bound.digits));
+				if (bound.value)
+					bound.value = fabs(*bound.value);
+				stack.push_back(bound);
+			}
+			else if (is<Floor>(token) || is<Ceil>(token)) {
+				charge(realLimbs);
+				stack.push_back(Bound{ Kind::Real, bound.digits, bound.value ? known(is<Floor>(token) ? floor(*bound.value) : ceil(*bound.value)) : nullopt });
+			}
+			else if (is<Result>(token)) {
+				charge(1.0);
+				stack.push_back(unknown());
+			}
+			else {
+				charge(transcendental_factor(token.get()) * functionScale);
+				double digits = 1.0;
+				if (is<Exp>(token))
+					digits = max(1.0, floor(largest(bound) / log(10.0)) + 1.0);
+				else if (is<Sqrt>(token))
+					digits = max(1.0, ceil(bound.digits / 2.0));
+				else if (is<Tan>(token))
+					digits = realDigits_m;		// unbounded near odd multiples of pi/2
+				stack.push_back(Bound{ Kind::Real, digits, nullopt });
+			}
+			continue;
+		}
+
+		if (is<TwoArgFunction>(token)) {
+			auto const rhs = pop();
+			auto const lhs = pop();
+			if (is<Max>(token) || is<Min>(token)) {
+				charge(realLimbs);
+				stack.push_back(Bound{ Kind::Real, max(lhs.digits, rhs.digits), nullopt });
+			}
+			else {
+				charge(transcendental_factor(token.get()) * functionScale);
+				double const digits = is<Pow>(token) ? max(1.0, lhs.digits * largest(rhs)) : 1.0;
+				stack.push_back(Bound{ Kind::Real, digits, nullopt });
+			}
+			continue;
+		}
+
+		// other operations: one step, and an unknown result
+		charge(1.0);
+		for (unsigned i = 0; i < convert<Operation>(token)->number_of_args(); ++i)
+			pop();
+		stack.push_back(unknown());
+	}
+
+	if (!stack.empty())
+		estimate.digits = saturate(stack.back().digits);
+	return estimate;
+}
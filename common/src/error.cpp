@@ -0,0 +1,54 @@
+/*!	\file	error.cpp
+	\brief	Error message table.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/error.hpp>
+
+
+
+/*! Gets the message of the exception the throwing interfaces raise for an error code. */
+[[nodiscard]] char const* message(ErrorCode code) {
+	switch (code) {
+	case ErrorCode::None:						return "No error";
+	case ErrorCode::BadCharacter:				return "Tokenizer::Bad character in expression.";
+	case ErrorCode::BadNumber:					return "Tokenizer::Bad character in expression.";
+	case ErrorCode::FunctionWithoutParenthesis:	return "Function not followed by (";
+	case ErrorCode::FactorialWithoutOperand:	return "Factorial must follow Expression";
+	case ErrorCode::UnmatchedRightParenthesis:	return "Right parenthesis has no matching left parenthesis";
+	case ErrorCode::MissingRightParenthesis:	return "Missing right-parenthesis";
+	case ErrorCode::InsufficientOperands:		return "Error: insufficient operands";
+	case ErrorCode::TooManyOperands:			return "Error: too many operands";
+	case ErrorCode::UnsupportedOperand:			return "Error: unsupported operand";
+	case ErrorCode::VariableNotInitialized:		return "Error: variable not initialized";
+	case ErrorCode::AssignmentToNonVariable:	return "Error: assignment to a non-variable.";
+	case ErrorCode::EvaluationFailed:			return "Error: evaluation failed";
+	case ErrorCode::StepLimitExceeded:			return "Error: step limit exceeded";
+	case ErrorCode::DigitLimitExceeded:			return "Error: digit limit exceeded";
+	case ErrorCode::TimeLimitExceeded:			return "Error: time limit exceeded";
+	case ErrorCode::Cancelled:					return "Error: evaluation cancelled";
+	case ErrorCode::AssignmentRejected:			return "Error: assignment not allowed in a snapshot evaluation";
+	}
+	return "Unknown error";
+}
@@ -8,6 +8,10 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added batch compilation, result cache, fused one-shot and streamed evaluation, try_evaluate().
+	Added evaluate_async().
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -32,11 +36,39 @@ the program(s) have been supplied.
 #include <ee/parser.hpp>
 #include <ee/RPNEvaluator.hpp>
 #include <ee/function.hpp>
+#include <ee/stream_parser.hpp>
+#include <ee/variable.hpp>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
 
 #if defined(SHOW_STEPS)
 #include <iostream>
 #endif
 
+/*! The evaluate_async() calls of one evaluator, run one at a time. */
+struct ExpressionEvaluator::AsyncQueue {
+	std::mutex								mutex;
+	std::condition_variable					idle;
+	std::deque<std::function<void()>>		jobs;
+	bool									running = false;	/// a job is queued on the pool, or running.
+};
+
+
+
+ExpressionEvaluator::ExpressionEvaluator() : async_m(std::make_unique<AsyncQueue>()) { }
+
+
+
+ExpressionEvaluator::~ExpressionEvaluator() {
+	std::unique_lock lock(async_m->mutex);
+	async_m->idle.wait(lock, [this] { return !async_m->running; });
+}
+
+
+
 [[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::evaluate( ExpressionEvaluator::expression_type const& expr ) {
 	TokenList infixTokens = tokenizer_m.tokenize(expr);
 #if defined(SHOW_STEPS)
@@ -56,6 +88,168 @@ the program(s) have been supplied.
 	}
 #endif
 
+	if (resultCache_m) {
+		std::optional<Hash128> inputs;
+		if (ResultCache::is_cacheable(postfixTokens) && (inputs = ResultCache::hash_inputs(postfixTokens))) {
+			ResultCache::Key key{ structural_hash(postfixTokens), *inputs };
+			if (auto cached = resultCache_m->find(key))
+				return *cached;
+			Operand::pointer_type result = rpn_m.evaluate(postfixTokens);
+			resultCache_m->insert(key, result);
+			return result;
+		}
+		resultCache_m->note_bypass();
+	}
+
 	Operand::pointer_type result = rpn_m.evaluate(postfixTokens);
 	return result;
 }
+
+
+
+/*!	Evaluates an expression without throwing.
+	@param expr [in] the expression.
+	@return the result, or the first error and the character offset where it was found;
+		errors found at the end of the expression (e.g. a missing ')') and evaluation errors are at expr.size().
+	*/
+[[nodiscard]] Expected<ExpressionEvaluator::result_type> ExpressionEvaluator::try_evaluate(expression_type const& expr) {
+	TokenList infixTokens;
+	std::vector<std::size_t> offsets;
+	Tokenizer::Cursor cursor(expr, false);
+	Error error;
+	while (auto token = tokenizer_m.try_next_token(cursor, error)) {
+		infixTokens.push_back(token);
+		offsets.push_back(cursor.token_offset());
+	}
+	if (error)
+		return error;
+
+	auto postfixTokens = parser_m.try_parse(infixTokens);
+	if (!postfixTokens) {
+		error = postfixTokens.error();
+		error.offset = error.offset < offsets.size() ? offsets[error.offset] : expr.size();
+		return error;
+	}
+
+	std::optional<ResultCache::Key> key;
+	if (resultCache_m) {
+		std::optional<Hash128> inputs;
+		if (ResultCache::is_cacheable(*postfixTokens) && (inputs = ResultCache::hash_inputs(*postfixTokens))) {
+			key = ResultCache::Key{ structural_hash(*postfixTokens), *inputs };
+			if (auto cached = resultCache_m->find(*key))
+				return result_type(*cached);
+		}
+		else
+			resultCache_m->note_bypass();
+	}
+
+	auto result = rpn_m.try_evaluate(*postfixTokens);
+	if (!result)
+		return Error{ result.error().code, expr.size() };
+	if (key)
+		resultCache_m->insert(*key, *result);
+	return result_type(*result);
+}
+
+
+
+/*!	Evaluates an expression in a single pass, without building the infix or postfix token lists.
+	The parser pulls each token from the tokenizer and pushes its output straight onto the evaluator's stack.
+	@param expr [in] the expression.
+	@note Same result as evaluate(), but the result cache is not consulted.
+	@note The expression is not validated before evaluation starts, so an evaluation error can be
+		reported ahead of a later syntax error, and assignments before a syntax error still take effect.
+	*/
+[[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::evaluate_once(expression_type const& expr) {
+	Tokenizer::Cursor cursor(expr);
+	parser_m.reset();
+	rpn_m.reset();
+	while (auto token = tokenizer_m.next_token(cursor))
+		parser_m.push(token, rpn_m);
+	parser_m.finish(rpn_m);
+	return rpn_m.finish();
+}
+
+
+
+/*!	Evaluates an expression read from a stream, in bounded memory (see StreamParser).
+	@param in [in] the expression text; read to the end.
+	@note Like evaluate_once(), evaluation runs as the expression is parsed.
+	*/
+[[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::evaluate_stream(std::istream& in) {
+	rpn_m.reset();
+	StreamParser(tokenizer_m).parse(in, rpn_m);
+	return rpn_m.finish();
+}
+
+
+
+/*!	Compiles an expression for evaluation over many rows.
+	@param expr [in] the expression.
+	@param rowVariables [in] the names of the variables supplied by each row, in row order.
+		All other variables are uniform: they keep their current value for the whole batch.
+	*/
+[[nodiscard]] BatchEvaluator ExpressionEvaluator::compile_batch(expression_type const& expr, std::vector<expression_type> const& rowVariables) {
+	BatchEvaluator::variable_list_type varying;
+	for (auto const& name : rowVariables)
+		varying.push_back(convert<Variable>(tokenizer_m.get_variable(name)));
+
+	return BatchEvaluator(parser_m.parse(tokenizer_m.tokenize(expr)), varying);
+}
+
+
+
+[[nodiscard]] std::future<Expected<ExpressionEvaluator::result_type>> ExpressionEvaluator::evaluate_async(expression_type expr, CancellationToken cancel, ThreadPool& pool) {
+	auto promise = std::make_shared<std::promise<Expected<result_type>>>();
+	auto future = promise->get_future();
+	{
+		std::lock_guard lock(async_m->mutex);
+		async_m->jobs.push_back([this, expr = std::move(expr), cancel = std::move(cancel), promise] {
+			if (cancel.cancelled()) {
+				promise->set_value(Error{ ErrorCode::Cancelled });
+				return;
+			}
+			rpn_m.use_cancellation(&cancel);
+			try {
+				auto result = try_evaluate(expr);
+				if (result && is<Variable>(*result) && convert<Variable>(*result)->value())
+					result = result_type(convert<Variable>(*result)->value());
+				promise->set_value(std::move(result));
+			}
+			catch (...) {
+				promise->set_exception(std::current_exception());
+			}
+			rpn_m.use_cancellation(nullptr);
+		});
+		if (async_m->running)
+			return future;
+		async_m->running = true;
+	}
+	pool.submit([this, &pool] { _run_async(pool); });
+	return future;
+}
+
+
+
+/*!	Runs the oldest pending evaluate_async() call, then queues itself again for the next one,
+	so the evaluators sharing a pool take turns.
+	*/
+void ExpressionEvaluator::_run_async(ThreadPool& pool) {
+	std::function<void()> job;
+	{
+		std::lock_guard lock(async_m->mutex);
+		job = std::move(async_m->jobs.front());
+		async_m->jobs.pop_front();
+	}
+	job();
+
+	{
+		std::lock_guard lock(async_m->mutex);
+		if (async_m->jobs.empty()) {
+			async_m->running = false;
+			async_m->idle.notify_all();
+			return;
+		}
+	}
+	pool.submit([this, &pool] { _run_async(pool); });
+}
@@ -0,0 +1,126 @@
+/*!	\file	function_cache.cpp
+	\brief	FunctionCache class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/function_cache.hpp>
+#include <ee/canonical.hpp>
+#include <ios>
+#include <limits>
+#include <utility>
+using namespace std;
+
+
+
+/*!	Gets the calling thread's cache. */
+[[nodiscard]] FunctionCache& FunctionCache::thread_local_cache() {
+	thread_local FunctionCache cache;
+	return cache;
+}
+
+
+
+/*!	Makes the key of a one argument function call.
+	The argument is written with every stored digit, so equal keys mean bit-identical arguments.
+	*/
+[[nodiscard]] FunctionCache::key_type FunctionCache::make_key(Token const& function, value_type const& arg) {
+	key_type key = token_tag(function);
+	key += '\0';
+	key += arg.str(numeric_limits<value_type>::max_digits10, ios_base::scientific);
+	return key;
+}
+
+
+
+/*!	Makes the key of a two argument function call. */
+[[nodiscard]] FunctionCache::key_type FunctionCache::make_key(Token const& function, value_type const& arg1, value_type const& arg2) {
+	key_type key = make_key(function, arg1);
+	key += '\0';
+	key += arg2.str(numeric_limits<value_type>::max_digits10, ios_base::scientific);
+	return key;
+}
+
+
+
+/*!	Finds a cached result, marking it as most recently used.
+	@return a pointer to the cached value, or nullptr on a miss.
+	*/
+[[nodiscard]] FunctionCache::value_type const* FunctionCache::find(key_type const& key) {
+	auto iter = index_m.find(key);
+	if (iter == index_m.end()) {
+		++stats_m.misses;
+		return nullptr;
+	}
+	++stats_m.hits;
+	lru_m.splice(lru_m.begin(), lru_m, iter->second);
+	return &iter->second->value;
+}
+
+
+
+/*!	Adds a result to the cache, evicting least recently used entries to stay within the budget. */
+void FunctionCache::insert(key_type key, value_type const& value) {
+	if (auto iter = index_m.find(key); iter != index_m.end()) {
+		iter->second->value = value;
+		lru_m.splice(lru_m.begin(), lru_m, iter->second);
+		return;
+	}
+
+	lru_m.push_front(Entry{ move(key), value });
+	index_m.emplace(lru_m.front().key, lru_m.begin());
+	stats_m.bytes += _entry_bytes(lru_m.front());
+	stats_m.entries = lru_m.size();
+	_evict_to_budget();
+}
+
+
+
+/*!	Removes every entry; the counters are kept. */
+void FunctionCache::clear() {
+	index_m.clear();
+	lru_m.clear();
+	stats_m.entries = 0;
+	stats_m.bytes = 0;
+}
+
+
+
+/*!	Changes the byte budget, evicting entries if the cache is now over budget. */
+void FunctionCache::set_budget(size_t byteBudget) {
+	budget_m = byteBudget;
+	_evict_to_budget();
+}
+
+
+
+void FunctionCache::_evict_to_budget() {
+	while (stats_m.bytes > budget_m && !lru_m.empty()) {
+		auto& victim = lru_m.back();
+		stats_m.bytes -= _entry_bytes(victim);
+		index_m.erase(victim.key);
+		lru_m.pop_back();
+		++stats_m.evictions;
+	}
+	stats_m.entries = lru_m.size();
+}
@@ -0,0 +1,201 @@
+/*!	\file	incremental_parser.cpp
+	\brief	IncrementalParser class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/incremental_parser.hpp>
+#include <ee/function.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <typeinfo>
+#include <utility>
+using namespace std;
+
+
+
+namespace {
+	/*! Collects postfix tokens into a TokenList. */
+	class TokenListSink : public TokenSink {
+		TokenList& list_m;
+	public:
+		explicit TokenListSink(TokenList& list) : list_m(list) { }
+		void push(Token::pointer_type const& token) override { list_m.push_back(token); }
+	};
+}
+
+
+
+/*!	Replaces the whole expression; everything is re-tokenized and re-parsed. */
+IncrementalParser::Update IncrementalParser::assign(string_type text) {
+	text_m = move(text);
+	lexError_m = Error{};
+
+	Update update;
+	_lex(0, 0, 0, numeric_limits<size_t>::max(), 0, update);
+	_parse(0, update);
+	return update;
+}
+
+
+
+/*!	Applies an edit to the expression.
+	@param offset [in] where the edit starts.
+	@param removedLength [in] the number of characters removed at 'offset'.
+	@param inserted [in] the text inserted at 'offset'.
+	@return the changed tokens, where the parser restarted, and the first error.
+	@note Throws std::out_of_range if the removed characters are not all in the text.
+	*/
+IncrementalParser::Update IncrementalParser::edit(size_t offset, size_t removedLength, string_view inserted) {
+	if (offset > text_m.size() || removedLength > text_m.size() - offset)
+		throw out_of_range("IncrementalParser::edit: edit is outside the text");
+
+	// the tokens stop at a bad character, so there is nothing after it to resynchronize with
+	if (lexError_m) {
+		string_type text = text_m;
+		text.replace(offset, removedLength, inserted);
+		return assign(move(text));
+	}
+
+	text_m.replace(offset, removedLength, inserted);
+
+	// first token that touches the edit; a function before it checked the text after it for '('
+	auto first = size_t(partition_point(lexemes_m.begin(), lexemes_m.end(), [offset](Lexeme const& lexeme) {
+		return lexeme.end() < offset;
+	}) - lexemes_m.begin());
+	if (first > 0 && is<Function>(lexemes_m[first - 1].token))
+		--first;
+	size_t const start = first < lexemes_m.size() ? min(offset, lexemes_m[first].offset) : offset;
+
+	Update update;
+	_lex(first, start, offset, offset + removedLength, ptrdiff_t(inserted.size()) - ptrdiff_t(removedLength), update);
+	_parse(update.first, update);
+	return update;
+}
+
+
+
+/*!	Gets the infix expression. */
+[[nodiscard]] TokenList IncrementalParser::infix() const {
+	TokenList tokens;
+	tokens.reserve(lexemes_m.size());
+	for (auto const& lexeme : lexemes_m)
+		tokens.push_back(lexeme.token);
+	return tokens;
+}
+
+
+
+/*!	Re-tokenizes from lexeme 'first', at character 'start' of the new text, until it resynchronizes
+	with an old lexeme after the edit (old characters [editBegin, editEnd), now 'delta' longer).
+	*/
+void IncrementalParser::_lex(size_t first, size_t start, size_t editBegin, size_t editEnd, ptrdiff_t delta, Update& update) {
+	auto const oldCount = lexemes_m.size();
+	auto const moved = [delta](Lexeme const& lexeme) { return ptrdiff_t(lexeme.offset) + delta; };
+
+	// old lexemes at or after the end of the edit are the resynchronization candidates
+	auto sync = first;
+	while (sync < oldCount && lexemes_m[sync].offset < editEnd)
+		++sync;
+
+	// the state after the last lexeme is stale after a bad character; the text starts expecting an operand
+	State const initial = first == 0 ? State::ExpectOperand : first < oldCount ? lexemes_m[first].state : endState_m;
+	Tokenizer::Cursor cursor(string_view(text_m).substr(start), start, initial, false);
+	vector<Lexeme> relexed;
+	bool synced = false;
+	Error error;
+	for (;;) {
+		State const state = cursor.state();
+		auto token = tokenizer_m.try_next_token(cursor, error);
+		if (!token)
+			break;
+
+		auto const at = cursor.token_offset();
+		while (sync < oldCount && moved(lexemes_m[sync]) < ptrdiff_t(at))
+			++sync;
+		if (sync < oldCount && moved(lexemes_m[sync]) == ptrdiff_t(at) && lexemes_m[sync].state == state) {
+			synced = true;
+			break;
+		}
+		relexed.push_back(Lexeme{ token, at, cursor.offset() - at, state });
+	}
+
+	lexError_m = error;
+	if (!synced) {
+		sync = oldCount;
+		endState_m = cursor.state();
+	}
+
+	// relexed lexemes identical to old ones ahead of the edit are not changes
+	size_t same = 0;
+	while (same < relexed.size() && first + same < sync) {
+		auto const& before = lexemes_m[first + same];
+		auto const& after = relexed[same];
+		if (before.end() > editBegin || before.offset != after.offset || before.length != after.length
+			|| before.state != after.state || typeid(*before.token) != typeid(*after.token))
+			break;
+		++same;
+	}
+
+	for (auto i = sync; i < oldCount; ++i)
+		lexemes_m[i].offset = size_t(moved(lexemes_m[i]));
+	lexemes_m.erase(lexemes_m.begin() + ptrdiff_t(first + same), lexemes_m.begin() + ptrdiff_t(sync));
+	lexemes_m.insert(lexemes_m.begin() + ptrdiff_t(first + same), relexed.begin() + ptrdiff_t(same), relexed.end());
+
+	update.first = first + same;
+	update.removed = sync - update.first;
+	update.inserted = relexed.size() - same;
+}
+
+
+
+/*!	Re-parses from the last sync point at or before lexeme 'firstChanged'. */
+void IncrementalParser::_parse(size_t firstChanged, Update& update) {
+	auto point = prev(upper_bound(syncPoints_m.begin(), syncPoints_m.end(), firstChanged, [](size_t token, SyncPoint const& sync) {
+		return token < sync.token;
+	}));
+	syncPoints_m.erase(next(point), syncPoints_m.end());
+	postfix_m.resize(point->output);
+	parser_m.restore(point->state);
+	update.reparsedFrom = point->token;
+
+	TokenListSink sink(postfix_m);
+	error_m = Error{};
+	for (auto i = point->token; i < lexemes_m.size(); ++i) {
+		if (i % sync_interval_c == 0 && i != syncPoints_m.back().token)
+			syncPoints_m.push_back(SyncPoint{ i, postfix_m.size(), parser_m.state() });
+		if (auto const code = parser_m.try_push(lexemes_m[i].token, sink); code != ErrorCode::None) {
+			error_m = Error{ code, lexemes_m[i].offset };
+			break;
+		}
+	}
+
+	// a syntax error before a bad character is the first error; the tokens end at a bad character
+	if (!error_m && lexError_m)
+		error_m = lexError_m;
+	if (!error_m)
+		if (auto const code = parser_m.try_finish(sink); code != ErrorCode::None)
+			error_m = Error{ code, text_m.size() };
+	update.error = error_m;
+}
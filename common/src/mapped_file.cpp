@@ -0,0 +1,115 @@
+/*!	\file	mapped_file.cpp
+	\brief	MappedFile class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/mapped_file.hpp>
+#include <system_error>
+
+#if defined(_WIN32)
+	#define NOMINMAX
+	#define WIN32_LEAN_AND_MEAN
+	#include <Windows.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+using namespace std;
+
+
+
+#if defined(_WIN32)
+namespace {
+	[[noreturn]] void throw_last_error(string const& what) {
+		throw system_error(int(GetLastError()), system_category(), what);
+	}
+}
+
+MappedFile::MappedFile(string const& path) {
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw_last_error("cannot open '" + path + "'");
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size)) {
+		CloseHandle(file);
+		throw_last_error("cannot get the size of '" + path + "'");
+	}
+	size_m = size_t(size.QuadPart);
+	if (size_m == 0) {
+		CloseHandle(file);
+		return;
+	}
+
+	// the view keeps the mapping, and the mapping keeps the file, open
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		throw_last_error("cannot map '" + path + "'");
+	data_m = static_cast<char const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	CloseHandle(mapping);
+	if (!data_m)
+		throw_last_error("cannot map '" + path + "'");
+}
+
+MappedFile::~MappedFile() {
+	if (data_m)
+		UnmapViewOfFile(data_m);
+}
+#else
+MappedFile::MappedFile(string const& path) {
+	int file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0)
+		throw system_error(errno, generic_category(), "cannot open '" + path + "'");
+
+	struct stat status;
+	if (fstat(file, &status) != 0) {
+		auto error = errno;
+		::close(file);
+		throw system_error(error, generic_category(), "cannot get the size of '" + path + "'");
+	}
+	size_m = size_t(status.st_size);
+	if (size_m == 0) {
+		::close(file);
+		return;
+	}
+
+	// the mapping stays valid after the file is closed
+	void* data = mmap(nullptr, size_m, PROT_READ, MAP_PRIVATE, file, 0);
+	auto error = errno;
+	::close(file);
+	if (data == MAP_FAILED)
+		throw system_error(error, generic_category(), "cannot map '" + path + "'");
+	madvise(data, size_m, MADV_SEQUENTIAL);
+	data_m = static_cast<char const*>(data);
+}
+
+MappedFile::~MappedFile() {
+	if (data_m)
+		munmap(const_cast<char*>(data_m), size_m);
+}
+#endif
@@ -7,6 +7,11 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Split parse() into push() and finish().
+	Precedence taken from Operator::get_precedence().
+	Added try_parse(), try_push(), try_finish(); the throwing functions wrap them.
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -43,94 +48,162 @@ the program(s) have been supplied.
 #include <stdexcept>
 
 
-[[nodiscard]] TokenList Parser::parse(TokenList const& infixTokens) {
-        auto precedence = [](Token::pointer_type const& token) {
-                if (is<Factorial>(token)) return 15;
-                if (is<Power>(token)) return 14;
-                if (is<Identity>(token) || is<Negation>(token) || is<Not>(token)) return 13;
-                if (is<Multiplication>(token) || is<Division>(token) || is<Modulus>(token)) return 12;
-                if (is<Addition>(token) || is<Subtraction>(token)) return 11;
-                if (is<Less>(token) || is<LessEqual>(token) || is<Greater>(token) || is<GreaterEqual>(token)) return 9;
-                if (is<Equality>(token) || is<Inequality>(token)) return 8;
-                if (is<And>(token) || is<Nand>(token)) return 6;
-                if (is<Xor>(token) || is<Xnor>(token)) return 5;
-                if (is<Or>(token) || is<Nor>(token)) return 4;
-                if (is<Assignment>(token)) return 1;
-                return 0;
-        };
+namespace {
+        /*! Operators share the precedence table declared by the operator classes (see DEF_PRECEDENCE). */
+        [[nodiscard]] Precedence precedence(Token::pointer_type const& token) {
+                return static_cast<Operator const&>(*token).get_precedence();
+        }
 
-        auto is_right_associative = [](Token::pointer_type const& token) {
-                return is<Power>(token) || is<Assignment>(token);
+        [[nodiscard]] bool is_right_associative(Token::pointer_type const& token) {
+                return is<RAssocOperator>(token);
+        }
+
+        /*! Collects postfix tokens into a TokenList. */
+        class TokenListSink : public TokenSink {
+                TokenList& list_m;
+        public:
+                explicit TokenListSink(TokenList& list) : list_m(list) { }
+                void push(Token::pointer_type const& token) override { list_m.push_back(token); }
         };
+}
 
+
+
+/*!	Converts an infix expression to postfix.
+	@return the postfix expression.
+	@param infixTokens [in] the infix expression from Tokenizer::tokenize().
+	*/
+[[nodiscard]] TokenList Parser::parse(TokenList const& infixTokens) {
         TokenList output;
-        std::stack<Token::pointer_type> opStack;
+        TokenListSink sink(output);
 
-        for (auto const& token : infixTokens) {
-                if (is<Operand>(token)) {
-                        output.push_back(token);
-                        continue;
-                }
+        reset();
+        for (auto const& token : infixTokens)
+                push(token, sink);
+        finish(sink);
+
+        return output;
+}
+
+
+
+/*!	Converts an infix expression to postfix without throwing.
+	@return the postfix expression, or the syntax error and the index of the token where it was found
+		(the number of tokens if it was found at the end).
+	@param infixTokens [in] the infix expression from Tokenizer::tokenize().
+	*/
+[[nodiscard]] Expected<TokenList> Parser::try_parse(TokenList const& infixTokens) {
+        TokenList output;
+        TokenListSink sink(output);
+
+        reset();
+        for (std::size_t i = 0; i < infixTokens.size(); ++i)
+                if (auto const code = try_push(infixTokens[i], sink); code != ErrorCode::None)
+                        return Error{ code, i };
+        if (auto const code = try_finish(sink); code != ErrorCode::None)
+                return Error{ code, infixTokens.size() };
+
+        return output;
+}
 
-                if (is<Function>(token)) {
-                        opStack.push(token);
-                        continue;
-                }
 
-                if (is<ArgumentSeparator>(token)) {
-                        while (!opStack.empty() && !is<LeftParenthesis>(opStack.top())) {
-                                output.push_back(opStack.top());
-                                opStack.pop();
-                        }
-                        continue;
-                }
 
-                if (is<LeftParenthesis>(token)) {
-                        opStack.push(token);
-                        continue;
+/*!	Parses the next infix token.
+	@param token [in] the next token of the infix expression.
+	@param output [in,out] receives the postfix tokens that can now be emitted.
+	*/
+void Parser::push(Token::pointer_type const& token, TokenSink& output) {
+        if (auto const code = try_push(token, output); code != ErrorCode::None)
+                throw XParser(message(code));
+}
+
+
+
+/*!	Parses the next infix token without throwing (see push()).
+	@return the syntax error, or ErrorCode::None.
+	*/
+[[nodiscard]] ErrorCode Parser::try_push(Token::pointer_type const& token, TokenSink& output) {
+        if (is<Operand>(token)) {
+                output.push(token);
+                return ErrorCode::None;
+        }
+
+        if (is<Function>(token)) {
+                opStack_m.push(token);
+                return ErrorCode::None;
+        }
+
+        if (is<ArgumentSeparator>(token)) {
+                while (!opStack_m.empty() && !is<LeftParenthesis>(opStack_m.top())) {
+                        output.push(opStack_m.top());
+                        opStack_m.pop();
                 }
+                return ErrorCode::None;
+        }
 
-                if (is<RightParenthesis>(token)) {
-                        while (!opStack.empty() && !is<LeftParenthesis>(opStack.top())) {
-                                output.push_back(opStack.top());
-                                opStack.pop();
-                        }
+        if (is<LeftParenthesis>(token)) {
+                opStack_m.push(token);
+                return ErrorCode::None;
+        }
 
-                        if (opStack.empty())
-                                throw std::runtime_error("Right parenthesis has no matching left parenthesis");
+        if (is<RightParenthesis>(token)) {
+                while (!opStack_m.empty() && !is<LeftParenthesis>(opStack_m.top())) {
+                        output.push(opStack_m.top());
+                        opStack_m.pop();
+                }
 
-                        opStack.pop();
+                if (opStack_m.empty())
+                        return ErrorCode::UnmatchedRightParenthesis;
 
-                        if (!opStack.empty() && is<Function>(opStack.top())) {
-                                output.push_back(opStack.top());
-                                opStack.pop();
-                        }
-                        continue;
+                opStack_m.pop();
+
+                if (!opStack_m.empty() && is<Function>(opStack_m.top())) {
+                        output.push(opStack_m.top());
+                        opStack_m.pop();
                 }
+                return ErrorCode::None;
+        }
 
-                if (is<Operator>(token)) {
-                        while (!opStack.empty() && is<Operator>(opStack.top())) {
-                                auto const top = opStack.top();
-                                auto const topPrec = precedence(top);
-                                auto const curPrec = precedence(token);
-                                if (topPrec > curPrec || (topPrec == curPrec && !is_right_associative(token))) {
-                                        output.push_back(top);
-                                        opStack.pop();
-                                }
-                                else
-                                        break;
+        if (is<Operator>(token)) {
+                while (!opStack_m.empty() && is<Operator>(opStack_m.top())) {
+                        auto const top = opStack_m.top();
+                        auto const topPrec = precedence(top);
+                        auto const curPrec = precedence(token);
+                        if (topPrec > curPrec || (topPrec == curPrec && !is_right_associative(token))) {
+                                output.push(top);
+                                opStack_m.pop();
                         }
-                        opStack.push(token);
-                        continue;
+                        else
+                                break;
                 }
+                opStack_m.push(token);
+                return ErrorCode::None;
         }
 
-        while (!opStack.empty()) {
-                        if (is<LeftParenthesis>(opStack.top()))
-                                throw std::runtime_error("Missing right-parenthesis");
-                        output.push_back(opStack.top());
-                        opStack.pop();
-        }
+        return ErrorCode::None;
+}
 
-        return output;
+
+
+/*!	Ends the infix expression, emitting the pending operators.
+	@param output [in,out] receives the remaining postfix tokens.
+	*/
+void Parser::finish(TokenSink& output) {
+        if (auto const code = try_finish(output); code != ErrorCode::None)
+                throw XParser(message(code));
+}
+
+
+
+/*!	Ends the infix expression without throwing (see finish()).
+	@return the syntax error, or ErrorCode::None.
+	*/
+[[nodiscard]] ErrorCode Parser::try_finish(TokenSink& output) {
+        while (!opStack_m.empty()) {
+                        if (is<LeftParenthesis>(opStack_m.top()))
+                                return ErrorCode::MissingRightParenthesis;
+                        output.push(opStack_m.top());
+                        opStack_m.pop();
+        }
+        return ErrorCode::None;
 }
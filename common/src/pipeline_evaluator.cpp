@@ -0,0 +1,173 @@
+/*!	\file	pipeline_evaluator.cpp
+	\brief	PipelineEvaluator class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/pipeline_evaluator.hpp>
+#include <ee/variable.hpp>
+#include <exception>
+#include <map>
+#include <thread>
+using namespace std;
+
+
+
+/*!	Evaluates every line from 'read', passing the outcomes to 'write' in input order.
+	@return the line and error counts, the elapsed time, and the usage of each queue.
+	@note Rethrows an exception thrown by 'read' once the lines read before it are written.
+	*/
+PipelineEvaluator::Statistics PipelineEvaluator::run(reader_type const& read, writer_type const& write) {
+	SpscQueue<Item> toTokenizer(queueCapacity_m), toParser(queueCapacity_m), toEvaluator(queueCapacity_m);
+	SpscQueue<Outcome> tokenizerDone(queueCapacity_m), parserDone(queueCapacity_m), evaluatorDone(queueCapacity_m);
+
+	Statistics stats;
+	auto const start = clock_type::now();
+	exception_ptr readError;
+
+	thread reader([&] {
+		try {
+			for (uint64_t line = 0; ; ++line) {
+				Item item;
+				item.line = line;
+				if (!read(item.text))
+					break;
+				item.start = clock_type::now();
+				toTokenizer.push(move(item));
+			}
+		}
+		catch (...) {
+			readError = current_exception();
+		}
+		toTokenizer.close();
+	});
+	thread tokenizer([&] { _tokenize(toTokenizer, toParser, tokenizerDone); });
+	thread parser([&] { _parse(toParser, toEvaluator, parserDone); });
+	thread evaluator([&] { _evaluate(toEvaluator, evaluatorDone); });
+
+	// re-sequence: the early exits from the tokenizer and parser overtake the evaluated lines
+	SpscQueue<Outcome>* const sources[] = { &tokenizerDone, &parserDone, &evaluatorDone };
+	map<uint64_t, Outcome> pending;
+	Outcome outcome;
+	for (unsigned idle = 0; ; ) {
+		bool popped = false;
+		for (auto source : sources)
+			while (source->try_pop(outcome)) {
+				pending.emplace(outcome.line, move(outcome));
+				popped = true;
+			}
+
+		for (auto next = pending.begin(); next != pending.end() && next->first == stats.lines; next = pending.erase(next)) {
+			if (next->second.error)
+				++stats.errors;
+			write(next->second);
+			++stats.lines;
+		}
+
+		if (popped)
+			idle = 0;
+		else if (tokenizerDone.drained() && parserDone.drained() && evaluatorDone.drained())
+			break;
+		else if (++idle > 64)
+			this_thread::yield();
+	}
+
+	reader.join();
+	tokenizer.join();
+	parser.join();
+	evaluator.join();
+	stats.seconds = chrono::duration<double>(clock_type::now() - start).count();
+
+	auto report = [&stats](char const* name, auto const& queue) { stats.queues.push_back(QueueReport{ name, queue.statistics() }); };
+	report("reader -> tokenizer", toTokenizer);
+	report("tokenizer -> parser", toParser);
+	report("parser -> evaluator", toEvaluator);
+	report("evaluator -> writer", evaluatorDone);
+	report("tokenizer -> writer", tokenizerDone);
+	report("parser -> writer", parserDone);
+
+	if (readError)
+		rethrow_exception(readError);
+	return stats;
+}
+
+
+
+void PipelineEvaluator::_tokenize(SpscQueue<Item>& in, SpscQueue<Item>& out, SpscQueue<Outcome>& done) {
+	Item item;
+	while (in.pop(item)) {
+		item.tokens.clear();
+		item.offsets.clear();
+		Tokenizer::Cursor cursor(item.text, false);
+		Error error;
+		while (auto token = tokenizer_m.try_next_token(cursor, error)) {
+			item.tokens.push_back(token);
+			item.offsets.push_back(cursor.token_offset());
+		}
+
+		if (error || item.tokens.empty())
+			done.push(Outcome{ item.line, nullptr, error, clock_type::now() - item.start });
+		else
+			out.push(move(item));
+	}
+	out.close();
+	done.close();
+}
+
+
+
+void PipelineEvaluator::_parse(SpscQueue<Item>& in, SpscQueue<Item>& out, SpscQueue<Outcome>& done) {
+	Item item;
+	while (in.pop(item)) {
+		auto postfix = parser_m.try_parse(item.tokens);
+		if (!postfix) {
+			auto error = postfix.error();
+			error.offset = error.offset < item.offsets.size() ? item.offsets[error.offset] : item.text.size();
+			done.push(Outcome{ item.line, nullptr, error, clock_type::now() - item.start });
+			continue;
+		}
+		item.postfix = move(*postfix);
+		out.push(move(item));
+	}
+	out.close();
+	done.close();
+}
+
+
+
+void PipelineEvaluator::_evaluate(SpscQueue<Item>& in, SpscQueue<Outcome>& done) {
+	Item item;
+	while (in.pop(item)) {
+		auto result = rpn_m.try_evaluate(item.postfix);
+		if (result) {
+			// later lines may assign the variable before the outcome is written, so take its value now
+			Operand::pointer_type value = *result;
+			if (is<Variable>(value) && convert<Variable>(value)->value())
+				value = convert<Variable>(value)->value();
+			done.push(Outcome{ item.line, value, Error{}, clock_type::now() - item.start });
+		}
+		else
+			done.push(Outcome{ item.line, nullptr, Error{ result.error().code, item.text.size() }, clock_type::now() - item.start });
+	}
+	done.close();
+}
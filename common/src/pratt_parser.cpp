@@ -0,0 +1,176 @@
+/*!	\file	pratt_parser.cpp
+	\brief	PrattParser class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/pratt_parser.hpp>
+#include <ee/function.hpp>
+#include <ee/operand.hpp>
+#include <ee/pseudo_operation.hpp>
+#include <ee/variable.hpp>
+#include <vector>
+using namespace std;
+
+
+
+/*!	Parses an expression.
+	@return the syntax tree; empty if the expression is empty.
+	@param expression [in] the expression to parse.
+	@note Throws Tokenizer::XTokenizer on lexical errors and XParser on syntax errors.
+	*/
+[[nodiscard]] Ast PrattParser::parse(string_type const& expression) {
+	Ast ast;
+	ast.reserve(expression.size() / 2 + 1);
+	Tokenizer::Cursor cursor(expression);
+	cursor_m = &cursor;
+	ast_m = &ast;
+
+	_advance();
+	if (current_m) {
+		(void)_parse_expression(Precedence::MIN);
+		if (is<RightParenthesis>(current_m))
+			throw XParser("Right parenthesis has no matching left parenthesis", currentSpan_m.offset);
+		if (current_m)
+			throw XParser("Unexpected token", currentSpan_m.offset);
+	}
+
+	cursor_m = nullptr;
+	ast_m = nullptr;
+	return ast;
+}
+
+
+
+/*! Scans the next token into the lookahead. */
+void PrattParser::_advance() {
+	current_m = tokenizer_m.next_token(*cursor_m);
+	currentSpan_m.offset = uint32_t(cursor_m->token_offset());
+	currentSpan_m.length = uint32_t(cursor_m->offset() - cursor_m->token_offset());
+}
+
+
+
+void PrattParser::_expect_right_parenthesis() {
+	if (!is<RightParenthesis>(current_m))
+		throw XParser("Missing right-parenthesis", currentSpan_m.offset);
+	_advance();
+}
+
+
+
+/*!	Parses operators that bind tighter than 'minPrecedence' (precedence climbing).
+	Left-associative operators parse their right operand at their own precedence, so an equal
+	operator that follows stops the operand; right-associative operators parse it one lower.
+	*/
+[[nodiscard]] PrattParser::Subexpression PrattParser::_parse_expression(Precedence minPrecedence) {
+	Subexpression lhs = _parse_prefix();
+
+	while (is<Operator>(current_m)) {
+		auto const precedence = static_cast<Operator const&>(*current_m).get_precedence();
+		if (precedence <= minPrecedence)
+			break;
+
+		auto const op = current_m;
+		if (is<PostfixOperator>(op)) {
+			Ast::Span span = _join(lhs.span, currentSpan_m);
+			_advance();
+			lhs = Subexpression{ ast_m->add(Ast::Kind::Postfix, op, span, { &lhs.node, 1 }), span };
+			continue;
+		}
+
+		if (!is<BinaryOperator>(op))
+			break;
+
+		_advance();
+		auto const rhsPrecedence = is<RAssocOperator>(op) ? Precedence(int(precedence) - 1) : precedence;
+		Subexpression rhs = _parse_expression(rhsPrecedence);
+		Ast::Span span = _join(lhs.span, rhs.span);
+		Ast::index_type const children[] = { lhs.node, rhs.node };
+		lhs = Subexpression{ ast_m->add(Ast::Kind::Binary, op, span, children), span };
+	}
+
+	return lhs;
+}
+
+
+
+/*!	Parses an operand, a parenthesized expression, a function call, or a prefix operator and its operand. */
+[[nodiscard]] PrattParser::Subexpression PrattParser::_parse_prefix() {
+	auto const token = current_m;
+	auto const span = currentSpan_m;
+
+	if (is<Operand>(token)) {
+		_advance();
+		auto const kind = is<Variable>(token) ? Ast::Kind::Variable : Ast::Kind::Literal;
+		return Subexpression{ ast_m->add(kind, token, span), span };
+	}
+
+	if (is<LeftParenthesis>(token)) {
+		_advance();
+		Subexpression inner = _parse_expression(Precedence::MIN);
+		inner.span = _join(span, currentSpan_m);
+		_expect_right_parenthesis();
+		return inner;
+	}
+
+	if (is<Function>(token)) {
+		_advance();
+		return _parse_call(token, span);
+	}
+
+	if (is<UnaryOperator>(token) && !is<PostfixOperator>(token)) {
+		_advance();
+		Subexpression operand = _parse_expression(Precedence::UNARY);
+		Ast::Span whole = _join(span, operand.span);
+		return Subexpression{ ast_m->add(Ast::Kind::Prefix, token, whole, { &operand.node, 1 }), whole };
+	}
+
+	throw XParser("Expected operand", span.offset);
+}
+
+
+
+/*!	Parses the parenthesized argument list of a function. */
+[[nodiscard]] PrattParser::Subexpression PrattParser::_parse_call(Token::pointer_type const& function, Ast::Span nameSpan) {
+	if (!is<LeftParenthesis>(current_m))
+		throw XParser("Function not followed by (", currentSpan_m.offset);
+	_advance();
+
+	vector<Ast::index_type> args;
+	if (!is<RightParenthesis>(current_m))
+		for (;;) {
+			args.push_back(_parse_expression(Precedence::MIN).node);
+			if (!is<ArgumentSeparator>(current_m))
+				break;
+			_advance();
+		}
+
+	Ast::Span span = _join(nameSpan, currentSpan_m);
+	_expect_right_parenthesis();
+
+	if (args.size() != static_cast<Function const&>(*function).number_of_args())
+		throw XParser("Wrong number of function arguments", nameSpan.offset);
+
+	return Subexpression{ ast_m->add(Ast::Kind::Call, function, span, args), span };
+}
@@ -0,0 +1,144 @@
+/*!	\file	result_cache.cpp
+	\brief	ResultCache class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/result_cache.hpp>
+#include <ee/function.hpp>
+#include <ee/operator.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <vector>
+using namespace std;
+
+
+
+/*!	Finds an unexpired result, marking it as most recently used. */
+[[nodiscard]] optional<ResultCache::value_type> ResultCache::find(Key const& key) {
+	auto iter = index_m.find(key);
+	if (iter == index_m.end()) {
+		++stats_m.misses;
+		return nullopt;
+	}
+	if (iter->second->expires <= clock_type::now()) {
+		_erase(iter->second);
+		++stats_m.expirations;
+		++stats_m.misses;
+		return nullopt;
+	}
+	++stats_m.hits;
+	lru_m.splice(lru_m.begin(), lru_m, iter->second);
+	return lru_m.front().value;
+}
+
+
+
+/*!	Adds a result, evicting the least recently used entry when the cache is full. */
+void ResultCache::insert(Key const& key, value_type const& value) {
+	if (capacity_m == 0)
+		return;
+
+	if (auto iter = index_m.find(key); iter != index_m.end())
+		_erase(iter->second);
+
+	while (lru_m.size() >= capacity_m) {
+		_erase(prev(lru_m.end()));
+		++stats_m.evictions;
+	}
+
+	lru_m.push_front(Entry{ key, value, clock_type::now() + ttl_m });
+	index_m.emplace(key, lru_m.begin());
+	stats_m.entries = lru_m.size();
+}
+
+
+
+/*!	Removes every expired entry. */
+void ResultCache::purge_expired() {
+	auto const now = clock_type::now();
+	for (auto iter = lru_m.begin(); iter != lru_m.end(); ) {
+		auto current = iter++;
+		if (current->expires <= now) {
+			_erase(current);
+			++stats_m.expirations;
+		}
+	}
+}
+
+
+
+/*!	Removes every entry; the counters are kept. */
+void ResultCache::clear() {
+	index_m.clear();
+	lru_m.clear();
+	stats_m.entries = 0;
+}
+
+
+
+void ResultCache::_erase(lru_type::iterator entry) {
+	index_m.erase(entry->key);
+	lru_m.erase(entry);
+	stats_m.entries = lru_m.size();
+}
+
+
+
+/*!	Tests if the result of a postfix expression depends only on the expression and its variables.
+	Assignments (side effects) and Result (history) make an expression uncacheable.
+	*/
+[[nodiscard]] bool ResultCache::is_cacheable(TokenList const& rpnExpression) {
+	return none_of(rpnExpression.begin(), rpnExpression.end(), [](Token::pointer_type const& token) {
+		return is<Assignment>(token) || is<Result>(token);
+	});
+}
+
+
+
+/*!	Hashes the current values of the variables read by a postfix expression.
+	@return the hash, or nothing if a variable is uninitialized.
+	*/
+[[nodiscard]] optional<Hash128> ResultCache::hash_inputs(TokenList const& rpnExpression) {
+	vector<Variable const*> variables;
+	for (auto const& token : rpnExpression)
+		if (is<Variable>(token))
+			variables.push_back(static_cast<Variable const*>(token.get()));
+
+	// hash each variable once, in name order, so the hash doesn't depend on operand order
+	sort(variables.begin(), variables.end(), [](Variable const* lhs, Variable const* rhs) {
+		return lhs->name() != rhs->name() ? lhs->name() < rhs->name() : lhs < rhs;
+	});
+	variables.erase(unique(variables.begin(), variables.end()), variables.end());
+
+	Hasher128 hasher;
+	for (auto variable : variables) {
+		auto value = variable->value();
+		if (!value)
+			return nullopt;
+		hasher.update(variable->name());
+		hasher.update(token_tag(*value));
+		hasher.update(exact_str(*value));
+	}
+	return hasher.digest();
+}
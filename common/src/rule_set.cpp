@@ -0,0 +1,185 @@
+/*!	\file	rule_set.cpp
+	\brief	RuleSet class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/rule_set.hpp>
+#include <ee/mapped_file.hpp>
+#include <ee/parser.hpp>
+#include <ee/tokenizer.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+using namespace std;
+
+
+
+namespace {
+	/*! Splits text into about 'count' pieces that each end at the end of a line. */
+	[[nodiscard]] vector<string_view> split_lines(string_view text, size_t count) {
+		vector<string_view> chunks;
+		size_t const target = text.size() / max<size_t>(count, 1) + 1;
+		for (size_t first = 0; first < text.size(); ) {
+			size_t last = min(first + target, text.size());
+			if (last < text.size()) {
+				auto newline = text.find('\n', last - 1);
+				last = newline == string_view::npos ? text.size() : newline + 1;
+			}
+			chunks.push_back(text.substr(first, last - first));
+			first = last;
+		}
+		return chunks;
+	}
+
+
+
+	/*! A rule before it is numbered from the start of the file. */
+	struct Compiled {
+		size_t		line;		/// from the start of the chunk.
+		TokenList	postfix;
+		Error		error;
+	};
+
+
+
+	/*! Compiles one line; parse errors are reported at the offset of the token in error. */
+	[[nodiscard]] Compiled compile_line(size_t line, string_view text, Tokenizer& tokenizer, Parser& parser,
+		TokenList& tokens, vector<size_t>& offsets) {
+		tokens.clear();
+		offsets.clear();
+		Tokenizer::Cursor cursor(text, false);
+		Error error;
+		while (auto token = tokenizer.try_next_token(cursor, error)) {
+			tokens.push_back(token);
+			offsets.push_back(cursor.token_offset());
+		}
+		if (error)
+			return Compiled{ line, {}, error };
+
+		auto postfix = parser.try_parse(tokens);
+		if (!postfix) {
+			error = postfix.error();
+			error.offset = error.offset < offsets.size() ? offsets[error.offset] : text.size();
+			return Compiled{ line, {}, error };
+		}
+		return Compiled{ line, move(*postfix), Error{} };
+	}
+
+
+
+	/*! The rules of one chunk, numbered from the start of the chunk. */
+	struct ChunkResult {
+		vector<Compiled>		rules;
+		size_t					lines = 0;
+	};
+
+	void compile_chunk(string_view chunk, Tokenizer& tokenizer, Parser& parser, ChunkResult& result) {
+		TokenList tokens;
+		vector<size_t> offsets;
+		for (size_t first = 0; first < chunk.size(); ++result.lines) {
+			size_t last = chunk.find('\n', first);
+			if (last == string_view::npos)
+				last = chunk.size();
+			auto line = chunk.substr(first, last - first);
+			first = last + 1;
+
+			if (!line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+			if (line.find_first_not_of(" \t") != string_view::npos)
+				result.rules.push_back(compile_line(result.lines, line, tokenizer, parser, tokens, offsets));
+		}
+	}
+}
+
+
+
+RuleSet RuleSet::compile(string_view text, unsigned threadCount, shared_ptr<SymbolTable> symbols) {
+	auto const start = chrono::steady_clock::now();
+	if (threadCount == 0)
+		threadCount = max(thread::hardware_concurrency(), 1u);
+	threadCount = unsigned(min<size_t>(threadCount, text.size() / min_chunk_size_c + 1));
+
+	RuleSet result;
+	result.symbols_m = symbols ? move(symbols) : make_shared<SymbolTable>();
+	auto const chunks = split_lines(text, threadCount == 1 ? 1 : size_t(threadCount) * chunks_per_thread_c);
+	vector<ChunkResult> compiled(chunks.size());
+
+	// every thread takes the next chunk until there are none left, so uneven chunks balance out
+	atomic<size_t> nextChunk{ 0 };
+	exception_ptr failure;
+	atomic_flag failed = ATOMIC_FLAG_INIT;
+	auto worker = [&] {
+		try {
+			Tokenizer tokenizer(*result.symbols_m);
+			Parser parser;
+			for (size_t chunk; (chunk = nextChunk.fetch_add(1, memory_order_relaxed)) < chunks.size(); )
+				compile_chunk(chunks[chunk], tokenizer, parser, compiled[chunk]);
+		}
+		catch (...) {
+			if (!failed.test_and_set())
+				failure = current_exception();
+			nextChunk = chunks.size();
+		}
+	};
+
+	vector<thread> threads;
+	for (unsigned i = 1; i < threadCount; ++i)
+		threads.emplace_back(worker);
+	worker();
+	for (auto& t : threads)
+		t.join();
+	if (failure)
+		rethrow_exception(failure);
+
+	// concatenate in file order, renumbering the lines from the start of the file
+	size_t ruleCount = 0;
+	for (auto const& chunk : compiled)
+		ruleCount += chunk.rules.size();
+	result.rules_m.reserve(ruleCount);
+	for (auto& chunk : compiled) {
+		for (auto& rule : chunk.rules) {
+			result.stats_m.errors += bool(rule.error);
+			result.rules_m.emplace_back(result.stats_m.lines + rule.line, move(rule.postfix), rule.error);
+		}
+		result.stats_m.lines += chunk.lines;
+	}
+
+	result.stats_m.rules = result.rules_m.size();
+	result.stats_m.chunks = chunks.size();
+	result.stats_m.threads = threadCount;
+	result.stats_m.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+
+
+RuleSet RuleSet::load(string const& path, unsigned threadCount, shared_ptr<SymbolTable> symbols) {
+	auto const start = chrono::steady_clock::now();
+	MappedFile file(path);
+	auto result = compile(file.view(), threadCount, move(symbols));
+	result.stats_m.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return result;
+}
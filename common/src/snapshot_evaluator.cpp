@@ -0,0 +1,231 @@
+/*!	\file	snapshot_evaluator.cpp
+	\brief	SnapshotEvaluator class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/snapshot_evaluator.hpp>
+#include <ee/cost_estimator.hpp>
+#include <ee/operator.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+using namespace std;
+
+
+
+VariableSnapshot::VariableSnapshot(value_list_type const& values) {
+	variables_m.reserve(values.size());
+	for (auto const& [variable, value] : values) {
+		variables_m.push_back(variable);
+		values_m[variable.get()] = value;
+	}
+}
+
+
+
+[[nodiscard]] VariableSnapshot VariableSnapshot::capture(TokenList const& variables) {
+	value_list_type values;
+	for (auto const& variable : variables)
+		if (is<Variable>(variable))
+			values.emplace_back(variable, convert<Variable>(variable)->value());
+	return VariableSnapshot(values);
+}
+
+
+
+namespace {
+	/*! Copies an expression with each variable replaced by its snapshot value.
+		@return an uninitialized variable error, located by token index, if a variable has no value.
+		*/
+	[[nodiscard]] Error bind(TokenList const& rpnExpression, VariableSnapshot const& snapshot, TokenList& bound) {
+		bound.clear();
+		for (size_t i = 0; i < rpnExpression.size(); ++i) {
+			auto const& token = rpnExpression[i];
+			if (!is<Variable>(token)) {
+				bound.push_back(token);
+				continue;
+			}
+			auto value = snapshot.find(token.get());
+			if (!value)
+				return Error{ ErrorCode::VariableNotInitialized, i };
+			bound.push_back(value);
+		}
+		return Error{};
+	}
+
+
+
+	/*! Gets the value of a result, so it can't change with the variable it came from. */
+	[[nodiscard]] Operand::pointer_type value_of_result(Operand::pointer_type const& result) {
+		return is<Variable>(result) ? convert<Variable>(result)->value() : result;
+	}
+}
+
+
+
+SnapshotEvaluator::SnapshotEvaluator(unsigned threadCount, AssignmentPolicy policy)
+	: pool_m(threadCount)
+	, bound_m(pool_m.size())
+	, policy_m(policy)
+{
+	for (unsigned worker = 0; worker < pool_m.size(); ++worker)
+		evaluators_m.push_back(make_unique<RPNEvaluator>());
+}
+
+
+
+/*!	Tests if an expression assigns a variable, i.e. has an effect beyond its result. */
+[[nodiscard]] bool SnapshotEvaluator::assigns(TokenList const& rpnExpression) {
+	return any_of(rpnExpression.begin(), rpnExpression.end(), [](Token::pointer_type const& token) { return is<Assignment>(token); });
+}
+
+
+
+SnapshotEvaluator::Report SnapshotEvaluator::evaluate(span<TokenList const> expressions, VariableSnapshot const& snapshot, span<Outcome> results) {
+	return _evaluate(expressions.size(), [&](size_t i) -> pair<TokenList const*, Error> { return { &expressions[i], Error{} }; }, snapshot, results);
+}
+
+
+
+SnapshotEvaluator::Report SnapshotEvaluator::evaluate(span<CompiledRule const> rules, VariableSnapshot const& snapshot, span<Outcome> results) {
+	return _evaluate(rules.size(), [&](size_t i) -> pair<TokenList const*, Error> { return { &rules[i].postfix(), rules[i].error() }; }, snapshot, results);
+}
+
+
+
+/*!	Evaluates 'count' expressions; source(i) gets the i'th expression and its compile error. */
+template <typename SOURCE>
+SnapshotEvaluator::Report SnapshotEvaluator::_evaluate(size_t count, SOURCE const& source, VariableSnapshot const& snapshot, span<Outcome> results) {
+	if (results.size() < count)
+		throw invalid_argument("SnapshotEvaluator::evaluate: the result array is smaller than the expression list");
+
+	auto const start = chrono::steady_clock::now();
+	vector<uint8_t> deferred(count, false);		// one writer per element, so no races
+
+	// estimate each expression with its snapshot values, then hand out the most expensive first,
+	// in chunks of about equal cost, so one slow expression doesn't leave the other workers idle
+	CostEstimator const estimator(0, [&](Token const& variable) { return snapshot.find(&variable); });
+	vector<double> costs(count);
+	pool_m.parallel_for(count, grain_c, [&](size_t begin, size_t end, unsigned) {
+		for (size_t i = begin; i < end; ++i)
+			costs[i] = estimator.estimate(*source(i).first).units;
+	});
+	vector<size_t> order(count);
+	iota(order.begin(), order.end(), size_t(0));
+	stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return costs[a] > costs[b]; });
+
+	Report report;
+	double const total = accumulate(costs.begin(), costs.end(), 0.0);
+	double const target = total / double(pool_m.size() * chunks_per_worker_c);
+	vector<size_t> chunks{ 0 };		// chunk k is order[chunks[k], chunks[k + 1])
+	double chunkCost = 0.0;
+	for (size_t i = 0; i < count; ++i) {
+		chunkCost += costs[order[i]];
+		if ((target > 0.0 && chunkCost >= target) || i + 1 - chunks.back() == grain_c || i + 1 == count) {
+			chunks.push_back(i + 1);
+			chunkCost = 0.0;
+		}
+	}
+	report.estimatedUnits = total;
+	report.chunks = chunks.size() - 1;
+
+	pool_m.parallel_for(chunks.size() - 1, 1, [&](size_t first, size_t last, unsigned worker) {
+		auto& rpn = *evaluators_m[worker];
+		auto& bound = bound_m[worker];
+		for (size_t k = chunks[first]; k < chunks[last]; ++k) {
+			size_t const i = order[k];
+			auto [expression, error] = source(i);
+			if (!error && assigns(*expression)) {
+				deferred[i] = true;
+				continue;
+			}
+			if (!error)
+				error = bind(*expression, snapshot, bound);
+			if (error) {
+				results[i] = Outcome{ nullptr, error };
+				continue;
+			}
+			rpn.reset();
+			auto result = rpn.try_evaluate(bound);
+			results[i] = result ? Outcome{ value_of_result(*result), Error{} } : Outcome{ nullptr, result.error() };
+		}
+	});
+
+	report.parallel = count - size_t(count_if(deferred.begin(), deferred.end(), [](uint8_t d) { return d != 0; }));
+
+	// the assigning expressions, in input order, against private copies of the variables
+	unordered_map<Token const*, Token::pointer_type> scratch;	// snapshot variable -> its copy
+	TokenList bound;
+	auto& rpn = *evaluators_m[0];
+	for (size_t i = 0; i < count; ++i) {
+		if (!deferred[i])
+			continue;
+		if (policy_m == AssignmentPolicy::Reject) {
+			results[i] = Outcome{ nullptr, Error{ ErrorCode::AssignmentRejected, 0 } };
+			++report.rejected;
+			continue;
+		}
+
+		TokenList const& expression = *source(i).first;
+		bound.clear();
+		for (auto const& token : expression) {
+			if (!is<Variable>(token)) {
+				bound.push_back(token);
+				continue;
+			}
+			auto [copy, added] = scratch.try_emplace(token.get());
+			if (added) {
+				copy->second = make<Variable>(convert<Variable>(token)->name());
+				convert<Variable>(copy->second)->set(snapshot.find(token.get()));
+			}
+			bound.push_back(copy->second);
+		}
+		rpn.reset();
+		auto result = rpn.try_evaluate(bound);
+		results[i] = result ? Outcome{ value_of_result(*result), Error{} } : Outcome{ nullptr, result.error() };
+		++report.serialized;
+	}
+
+	// report the assigned variables: those whose copy no longer has the snapshot value
+	for (size_t i = 0; i < count && !scratch.empty(); ++i) {
+		if (!deferred[i])
+			continue;
+		for (auto const& token : *source(i).first) {
+			auto copy = scratch.find(token.get());
+			if (copy == scratch.end())
+				continue;
+			auto value = convert<Variable>(copy->second)->value();
+			if (value.get() != snapshot.find(token.get()).get())
+				report.assignments.emplace_back(token, value);
+			scratch.erase(copy);
+		}
+	}
+
+	for (size_t i = 0; i < count; ++i)
+		report.errors += bool(results[i].error);
+	report.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return report;
+}
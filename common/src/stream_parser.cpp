@@ -0,0 +1,125 @@
+/*!	\file	stream_parser.cpp
+	\brief	StreamParser class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/stream_parser.hpp>
+#include <algorithm>
+#include <istream>
+#include <stdexcept>
+using namespace std;
+
+
+
+/*!	Parses an expression read from a stream.
+	@param in [in] the expression text; read to the end.
+	@param output [in,out] receives the postfix tokens.
+	@note Throws Tokenizer::XTokenizer and Parser::XParser with offsets into the whole stream.
+	*/
+void StreamParser::parse(istream& in, TokenSink& output) {
+	parser_m.reset();
+	peakBuffer_m = 0;
+
+	string buffer;
+	Tokenizer::Cursor cursor(string_view(), false);
+	for (bool atEnd = false; !atEnd; ) {
+		auto const kept = buffer.size();
+		buffer.resize(kept + chunkSize_m);
+		in.read(buffer.data() + kept, streamsize(chunkSize_m));
+		buffer.resize(kept + size_t(in.gcount()));
+		if (in.bad())
+			throw runtime_error("Error: failed reading expression stream");
+		atEnd = in.eof() || in.gcount() == 0;
+		peakBuffer_m = max(peakBuffer_m, buffer.size());
+
+		// scan up to the last safe cut; the rest waits for more input
+		auto const cut = atEnd ? buffer.size() : _safe_cut(buffer);
+		if (cut == 0)
+			continue;
+		cursor.continue_with(string_view(buffer.data(), cut));
+		_parse_piece(cursor, output);
+		buffer.erase(0, cut);
+	}
+
+	_finish(cursor, output);
+}
+
+
+
+/*!	Parses an expression held in memory, such as a memory-mapped file, without copying it.
+	@param source [in] the expression text.
+	@param output [in,out] receives the postfix tokens.
+	*/
+void StreamParser::parse(string_view source, TokenSink& output) {
+	parser_m.reset();
+	peakBuffer_m = 0;
+
+	Tokenizer::Cursor cursor(source, false);
+	_parse_piece(cursor, output);
+	_finish(cursor, output);
+}
+
+
+
+/*! Tokenizes and parses the rest of the cursor's piece of input. */
+void StreamParser::_parse_piece(Tokenizer::Cursor& cursor, TokenSink& output) {
+	while (auto token = tokenizer_m.next_token(cursor)) {
+		try {
+			parser_m.push(token, output);
+		}
+		catch (Parser::XParser const& ex) {
+			throw Parser::XParser(ex.what(), cursor.token_offset());
+		}
+	}
+}
+
+
+
+void StreamParser::_finish(Tokenizer::Cursor const& cursor, TokenSink& output) {
+	try {
+		parser_m.finish(output);
+	}
+	catch (Parser::XParser const& ex) {
+		throw Parser::XParser(ex.what(), cursor.offset());
+	}
+}
+
+
+
+/*!	Finds the last place the buffer can be split without splitting a token.
+	A split is safe just before an operator character (other than '(', which a function name
+	looks ahead for) that does not form a two-character operator with the character before it.
+	@return the number of characters before the split, or 0 if there is none.
+	*/
+[[nodiscard]] size_t StreamParser::_safe_cut(string_view buffer) {
+	auto is_one_of = [](char ch, string_view set) { return set.find(ch) != string_view::npos; };
+	auto joins = [&](char first, char second) {
+		return (second == '=' && is_one_of(first, "<>=!")) || (first == '*' && second == '*');
+	};
+
+	for (size_t i = buffer.size(); i-- > 1; )
+		if (is_one_of(buffer[i], "+-*/%),<>=!") && !joins(buffer[i - 1], buffer[i]))
+			return i;
+	return 0;
+}
@@ -0,0 +1,71 @@
+/*!	\file	symbol_table.cpp
+	\brief	SymbolTable class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/symbol_table.hpp>
+#include <ee/variable.hpp>
+#include <mutex>
+using namespace std;
+
+
+
+/*!	Gets the variable token with the given name, adding an uninitialized one if there is none. */
+[[nodiscard]] Token::pointer_type SymbolTable::intern(string_type const& name) {
+	auto& shard = _shard(name);
+	{
+		shared_lock lock(shard.mutex);
+		if (auto iter = shard.variables.find(name); iter != shard.variables.end())
+			return iter->second;
+	}
+
+	// another thread may add the name between the locks; try_emplace keeps the first one
+	unique_lock lock(shard.mutex);
+	auto [iter, added] = shard.variables.try_emplace(name);
+	if (added)
+		iter->second = make<Variable>(name);
+	return iter->second;
+}
+
+
+
+/*!	Gets the variable token with the given name, or nullptr if it hasn't been interned. */
+[[nodiscard]] Token::pointer_type SymbolTable::find(string_type const& name) const {
+	auto const& shard = _shard(name);
+	shared_lock lock(shard.mutex);
+	auto iter = shard.variables.find(name);
+	return iter == shard.variables.end() ? nullptr : iter->second;
+}
+
+
+
+/*!	Gets the number of interned names. */
+[[nodiscard]] size_t SymbolTable::size() const {
+	size_t count = 0;
+	for (auto const& shard : shards_m) {
+		shared_lock lock(shard.mutex);
+		count += shard.variables.size();
+	}
+	return count;
+}
@@ -0,0 +1,165 @@
+/*!	\file	thread_pool.cpp
+	\brief	ThreadPool class implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/thread_pool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+using namespace std;
+
+
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+	if (threadCount == 0)
+		threadCount = max(thread::hardware_concurrency(), 1u);
+	for (unsigned worker = 1; worker < threadCount; ++worker)
+		threads_m.emplace_back([this, worker] { _work(worker); });
+}
+
+
+
+/*! Queued tasks are run before the threads stop. */
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard lock(mutex_m);
+		stopping_m = true;
+	}
+	wake_m.notify_all();
+	for (auto& t : threads_m)
+		t.join();
+}
+
+
+
+/*!	Runs 'body' over [0, count) in pieces of 'grain' items, on every worker, and waits for it to finish.
+	The pieces are handed out in order as workers become free, so uneven items balance out.
+	@note Rethrows the first exception thrown by 'body', once every worker has stopped.
+	*/
+void ThreadPool::parallel_for(size_t count, size_t grain, body_type const& body) {
+	if (count == 0)
+		return;
+	grain = max<size_t>(grain, 1);
+
+	lock_guard loop(loop_m);
+	atomic<size_t> next{ 0 };
+	exception_ptr failure;
+	atomic_flag failed = ATOMIC_FLAG_INIT;
+	auto job = [&](unsigned worker) {
+		try {
+			for (size_t begin; (begin = next.fetch_add(grain, memory_order_relaxed)) < count; )
+				body(begin, min(begin + grain, count), worker);
+		}
+		catch (...) {
+			if (!failed.test_and_set())
+				failure = current_exception();
+			next = count;
+		}
+	};
+
+	// only wake the pool if there is more than one piece
+	bool const shared = !threads_m.empty() && count > grain;
+	if (shared) {
+		lock_guard lock(mutex_m);
+		job_m = job;
+		running_m = unsigned(threads_m.size());
+		++generation_m;
+	}
+	if (shared)
+		wake_m.notify_all();
+
+	job(0);
+
+	if (shared) {
+		unique_lock lock(mutex_m);
+		done_m.wait(lock, [this] { return running_m == 0; });
+		job_m = nullptr;
+	}
+	if (failure)
+		rethrow_exception(failure);
+}
+
+
+
+void ThreadPool::submit(function<void()> task) {
+	if (threads_m.empty()) {
+		try { task(); } catch (...) { }
+		return;
+	}
+	{
+		lock_guard lock(mutex_m);
+		tasks_m.push_back(move(task));
+	}
+	wake_m.notify_all();
+}
+
+
+
+[[nodiscard]] ThreadPool& ThreadPool::shared() {
+	static ThreadPool pool(max(thread::hardware_concurrency(), 1u) + 1);
+	return pool;
+}
+
+
+
+/*! Runs loops and tasks; a loop goes first, as its caller is waiting for every worker. */
+void ThreadPool::_work(unsigned worker) {
+	uint64_t seen = 0;
+	for (;;) {
+		function<void(unsigned)> job;
+		function<void()> task;
+		{
+			unique_lock lock(mutex_m);
+			wake_m.wait(lock, [&] { return stopping_m || generation_m != seen || !tasks_m.empty(); });
+			if (generation_m != seen && job_m) {
+				seen = generation_m;
+				job = job_m;
+			}
+			else if (!tasks_m.empty()) {
+				task = move(tasks_m.front());
+				tasks_m.pop_front();
+			}
+			else if (stopping_m)
+				return;
+			else {
+				seen = generation_m;
+				continue;
+			}
+		}
+
+		if (task) {
+			try { task(); } catch (...) { }
+			continue;
+		}
+
+		job(worker);
+
+		{
+			lock_guard lock(mutex_m);
+			if (--running_m == 0)
+				done_m.notify_one();
+		}
+	}
+}
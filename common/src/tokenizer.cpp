@@ -23,6 +23,14 @@ Version 2014.10.29
 	Converted Integer::value_type to boost::multiprecision::cpp_int
 	Removed BinaryInteger
 
+Version 2026.10.17
+	Added next_token() to scan one token at a time; tokenize() is built on it.
+	Errors report offsets in the whole input and may omit the source copy.
+	Added try_tokenize() and try_next_token(); the throwing functions wrap them.
+	Replaced the CHECK_OP/CHECK_2OP chain and isspace/isdigit/isalnum with a
+	character class table and a two state DFA (unary vs. binary context).
+	Whitespace, digit and identifier runs are skipped with SSE2/AVX2 scanners.
+
 Version 2012.11.16
 	Added BitAnd, BitNot, BitOr, BitXOr, BitShiftLeft, BitShiftRight
 	Simplified CHECK_OP macros
@@ -57,6 +65,7 @@ the program(s) have been supplied.
 =============================================================*/
 
 #include <ee/tokenizer.hpp>
+#include <ee/char_scan.hpp>
 #include <ee/boolean.hpp>
 #include <ee/function.hpp>
 #include <ee/integer.hpp>
@@ -65,13 +74,126 @@ the program(s) have been supplied.
 #include <ee/real.hpp>
 #include <ee/variable.hpp>
 
+#include <array>
+#include <cstdint>
 #include <exception>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <string>
 using namespace std;
 
+
+
+namespace {
+        /*	Lexer DFA.
+		Every byte maps to a character class; the class and the scanner state (does an operand or an
+		operator come next?) index one transition, which says how to scan the token and the next state.
+		The state replaces looking at the previous token to tell unary from binary +/- and to reject a
+		leading '!'.
+		*/
+        using State = Tokenizer::Cursor::State;
+        using TokenMaker = Token::pointer_type (*)();
+
+        enum class CharClass : std::uint8_t {
+                Other, Space, Digit, Letter,
+                Less, Greater, Equals, Bang, Star, Slash, Percent, LeftParen, RightParen, Comma, Plus, Minus,
+                count_
+        };
+
+        [[nodiscard]] constexpr array<CharClass, 256> make_char_classes() {
+                array<CharClass, 256> classes{};
+                for (unsigned char c : { ' ', '\t', '\n', '\v', '\f', '\r' })
+                        classes[c] = CharClass::Space;
+                for (unsigned c = '0'; c <= '9'; ++c)
+                        classes[c] = CharClass::Digit;
+                for (unsigned c = 'a'; c <= 'z'; ++c)
+                        classes[c] = classes[c - 'a' + 'A'] = CharClass::Letter;
+                classes['<'] = CharClass::Less;
+                classes['>'] = CharClass::Greater;
+                classes['='] = CharClass::Equals;
+                classes['!'] = CharClass::Bang;
+                classes['*'] = CharClass::Star;
+                classes['/'] = CharClass::Slash;
+                classes['%'] = CharClass::Percent;
+                classes['('] = CharClass::LeftParen;
+                classes[')'] = CharClass::RightParen;
+                classes[','] = CharClass::Comma;
+                classes['+'] = CharClass::Plus;
+                classes['-'] = CharClass::Minus;
+                return classes;
+        }
+        constexpr array<CharClass, 256> charClasses_c = make_char_classes();
+
+        [[nodiscard]] constexpr CharClass char_class(char c) { return charClasses_c[static_cast<unsigned char>(c)]; }
+        [[nodiscard]] constexpr bool is_digit(char c) { return char_class(c) == CharClass::Digit; }
+
+        enum class Action : std::uint8_t { BadCharacter, Number, Identifier, Operator };
+
+        /*	A transition.  Operators are one character, or two when followed by 'second'.
+		A one character operator with no token is the error 'error'.
+		*/
+        struct Transition {
+                Action		action = Action::BadCharacter;
+                TokenMaker	single = nullptr;
+                State		singleNext = State::ExpectOperand;
+                char		second = '\0';
+                TokenMaker	pair = nullptr;
+                State		pairNext = State::ExpectOperand;
+                ErrorCode	error = ErrorCode::BadCharacter;
+        };
+
+        constexpr size_t stateCount_c = 2;
+        constexpr size_t classCount_c = size_t(CharClass::count_);
+        using TransitionTable = array<array<Transition, classCount_c>, stateCount_c>;
+
+        template <typename T> [[nodiscard]] Token::pointer_type make_token() { return make<T>(); }
+
+        [[nodiscard]] constexpr TransitionTable make_transitions() {
+                TransitionTable table{};
+                auto set = [&](State state, CharClass cc, TokenMaker single, State singleNext, char second = '\0', TokenMaker pair = nullptr) {
+                        table[size_t(state)][size_t(cc)] = Transition{ Action::Operator, single, singleNext, second, pair, State::ExpectOperand };
+                };
+
+                for (auto state : { State::ExpectOperand, State::ExpectOperator }) {
+                        table[size_t(state)][size_t(CharClass::Digit)].action = Action::Number;
+                        table[size_t(state)][size_t(CharClass::Letter)].action = Action::Identifier;
+
+                        // binary operators regardless of state, as the parser reports misplaced ones
+                        set(state, CharClass::Less,			&make_token<Less>,				State::ExpectOperand, '=', &make_token<LessEqual>);
+                        set(state, CharClass::Greater,		&make_token<Greater>,			State::ExpectOperand, '=', &make_token<GreaterEqual>);
+                        set(state, CharClass::Equals,		&make_token<Assignment>,		State::ExpectOperand, '=', &make_token<Equality>);
+                        set(state, CharClass::Star,			&make_token<Multiplication>,	State::ExpectOperand, '*', &make_token<Power>);
+                        set(state, CharClass::Slash,		&make_token<Division>,			State::ExpectOperand);
+                        set(state, CharClass::Percent,		&make_token<Modulus>,			State::ExpectOperand);
+                        set(state, CharClass::LeftParen,	&make_token<LeftParenthesis>,	State::ExpectOperand);
+                        set(state, CharClass::RightParen,	&make_token<RightParenthesis>,	State::ExpectOperator);
+                        set(state, CharClass::Comma,		&make_token<ArgumentSeparator>,	State::ExpectOperand);
+                }
+
+                // unary where an operand is expected, binary after one
+                set(State::ExpectOperand,	CharClass::Plus,	&make_token<Identity>,		State::ExpectOperand);
+                set(State::ExpectOperator,	CharClass::Plus,	&make_token<Addition>,		State::ExpectOperand);
+                set(State::ExpectOperand,	CharClass::Minus,	&make_token<Negation>,		State::ExpectOperand);
+                set(State::ExpectOperator,	CharClass::Minus,	&make_token<Subtraction>,	State::ExpectOperand);
+
+                // '!' must follow an operand; '!=' may appear anywhere
+                set(State::ExpectOperand,	CharClass::Bang,	nullptr,					State::ExpectOperand, '=', &make_token<Inequality>);
+                table[size_t(State::ExpectOperand)][size_t(CharClass::Bang)].error = ErrorCode::FactorialWithoutOperand;
+                set(State::ExpectOperator,	CharClass::Bang,	&make_token<Factorial>,		State::ExpectOperator, '=', &make_token<Inequality>);
+                return table;
+        }
+        constexpr TransitionTable transitions_c = make_transitions();
+
+        /*	Runs of spaces, digits and identifier characters are skipped by the vectorized scanners (ee/char_scan.hpp). */
+        template <char const* (*RUN_END)(char const*, char const*)>
+        [[nodiscard]] Tokenizer::Cursor::iterator_type skip(Tokenizer::Cursor::iterator_type first, Tokenizer::Cursor::iterator_type last) {
+                char const* const p = to_address(first);
+                return first + (RUN_END(p, p + (last - first)) - p);
+        }
+}
+
 /** Default constructor loads the keyword dictionary. */
 Tokenizer::Tokenizer() {
 	keywords_m["abs"]     = keywords_m["Abs"]		= keywords_m["ABS"]		= make<Abs>();
@@ -109,30 +231,54 @@ Tokenizer::Tokenizer() {
 
 
 
+/** Constructs a tokenizer that interns its variables in a shared symbol table.
+	@param symbols [in] the table; it must outlive the tokenizer.
+	*/
+Tokenizer::Tokenizer(SymbolTable& symbols) : Tokenizer() {
+	symbols_m = &symbols;
+}
+
+
+
 
 /** Get an identifier from the expression.
 	Assumes that the currentChar is pointing to a alphabetic.
 	*/
-Token::pointer_type Tokenizer::_get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
+Token::pointer_type Tokenizer::_get_identifier(Cursor& cursor) {
+	auto const expression = cursor.expression_m;
+	auto& currentChar = cursor.current_m;
+
 	// accumulate identifier
-	string_type ident;
-	do
-		ident += *currentChar++;
-	while (currentChar != end(expression) && isalnum(*currentChar));
+	auto const first = currentChar;
+	currentChar = skip<alnum_run_end>(next(currentChar), end(expression));
+	string_type ident(first, currentChar);
 
 	// check for predefined identifier
 	dictionary_type::iterator iter = keywords_m.find(ident);
 	if (iter != end(keywords_m))
 		return iter->second;
 
+	return get_variable(ident);
+}
+
+
+
+/** Get the variable token with the given name.
+	@return the existing variable token, or a new uninitialized one that is added to the dictionary.
+	@param name [in] the variable identifier.
+	*/
+Token::pointer_type Tokenizer::get_variable(string_type const& name) {
+        if (symbols_m)
+                return symbols_m->intern(name);
+
 	// check for variable
-	iter = variables_m.find(ident);
+	dictionary_type::iterator iter = variables_m.find(name);
 	if (iter != variables_m.end())
 		return iter->second;
 
 	// add a variable
-	Token::pointer_type result = make<Variable>();
-	variables_m[ident] = result;
+	Token::pointer_type result = make<Variable>(name);
+	variables_m[name] = result;
 	return result;
 }
 
@@ -140,28 +286,48 @@ Token::pointer_type Tokenizer::_get_identifier(Tokenizer::string_type::const_ite
 
 
 /** Get a number token from the expression.
-	@return One of BinaryInteger, Integer, or Real.
-	@param currentChar [in,out] an iterator to the current character.  Assumes that the currentChar is pointing to a digit.
-	@param expression [in] the expression being scanned.
+	@return One of Integer (decimal, or binary with the prefix 0b), or Real.
+	@param cursor [in,out] the current character.  Assumes that the current character is a digit.
+	@param error [out] set if the number is malformed; nullptr is returned.
 */
-Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
-	assert(isdigit(*currentChar) && "currentChar must pointer to a digit");
+Token::pointer_type Tokenizer::_get_number(Cursor& cursor, Error& error) {
+	auto const expression = cursor.expression_m;
+	auto& currentChar = cursor.current_m;
+	assert(is_digit(*currentChar) && "currentChar must pointer to a digit");
+
+        // binary literal 0b....
+        if (*currentChar == '0') {
+                auto nextChar = next(currentChar);
+                if (nextChar != end(expression) && (*nextChar == 'b' || *nextChar == 'B')) {
+                        currentChar = next(nextChar);
+                        if (currentChar == end(expression) || (*currentChar != '0' && *currentChar != '1'))
+                                return _fail(cursor, currentChar, ErrorCode::BadNumber, error);
+                        Integer::value_type value(0);
+                        while (currentChar != end(expression) && (*currentChar == '0' || *currentChar == '1')) {
+                                value <<= 1;
+                                if (*currentChar == '1')
+                                        value += 1;
+                                ++currentChar;
+                        }
+                        return make<Integer>(value);
+                }
+        }
 
 	// Either Integer or Real
-	string digits(1, *currentChar++);
-
-	while (currentChar != end(expression) && isdigit(*currentChar))
-		digits += *currentChar++;
+	auto const first = currentChar;
+	currentChar = skip<digit_run_end>(next(currentChar), end(expression));
+	string digits(first, currentChar);
 
-	if (currentChar == end(expression) || (!isdigit(*currentChar) && *currentChar != '.'))
+	if (currentChar == end(expression) || (!is_digit(*currentChar) && *currentChar != '.'))
 		return make<Integer>(Integer::value_type(digits));
 
         // a real number
         digits += *currentChar++;
-        if (currentChar == end(expression) || !isdigit(*currentChar))
-                throw XTokenizer(expression, currentChar - begin(expression), "Tokenizer::Bad character in expression.");
-        while (currentChar != end(expression) && isdigit(*currentChar))
-                digits += *currentChar++;
+        if (currentChar == end(expression) || !is_digit(*currentChar))
+                return _fail(cursor, currentChar, ErrorCode::BadNumber, error);
+        auto const fraction = currentChar;
+        currentChar = skip<digit_run_end>(currentChar, end(expression));
+        digits.append(fraction, currentChar);
 
         return make<Real>(Real::value_type(digits));
 }
@@ -176,165 +342,123 @@ Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterato
 	*/
 TokenList Tokenizer::tokenize(string_type const& expression) {
         TokenList tokenizedExpression;
-        auto currentChar = expression.cbegin();
-
-        enum class PrevCategory { Start, Operand, RightParenthesis, PostfixOp, Function, Other };
-        auto classify_prev = [](Token::pointer_type const& token) {
-                if (!token)
-                        return PrevCategory::Start;
-                if (is<Operand>(token))
-                        return PrevCategory::Operand;
-                if (is<RightParenthesis>(token))
-                        return PrevCategory::RightParenthesis;
-                if (is<PostfixOperator>(token))
-                        return PrevCategory::PostfixOp;
-                if (is<Function>(token))
-                        return PrevCategory::Function;
-                return PrevCategory::Other;
-        };
+        Cursor cursor(expression);
+        while (auto token = next_token(cursor))
+                tokenizedExpression.push_back(token);
+        return tokenizedExpression;
+}
 
-        PrevCategory prev = PrevCategory::Start;
 
-        auto expect_function_paren = [&](Tokenizer::string_type::const_iterator lookahead) {
-                while (lookahead != end(expression) && isspace(*lookahead))
-                        ++lookahead;
-                if (lookahead == end(expression) || *lookahead != '(')
-                        throw XTokenizer(expression, lookahead - begin(expression), "Function not followed by (");
-        };
 
-        for(;;)
-        {
-                // strip whitespace
-                while (currentChar != end(expression) && isspace(*currentChar))
-                        ++currentChar;
-
-                // check of end of expression
-                if (currentChar == end(expression)) break;
-
-                // check for a number
-                if (isdigit(*currentChar)) {
-                        // binary literal 0b....
-                        if (*currentChar == '0') {
-                                auto nextChar = next(currentChar);
-                                if (nextChar != end(expression) && (*nextChar == 'b' || *nextChar == 'B')) {
-                                        currentChar = next(nextChar);
-                                        if (currentChar == end(expression) || (*currentChar != '0' && *currentChar != '1'))
-                                                throw XTokenizer(expression, currentChar - begin(expression), "Tokenizer::Bad character in expression.");
-                                        Integer::value_type value(0);
-                                        while (currentChar != end(expression) && (*currentChar == '0' || *currentChar == '1')) {
-                                                value <<= 1;
-                                                if (*currentChar == '1')
-                                                        value += 1;
-                                                ++currentChar;
-                                        }
-                                        tokenizedExpression.push_back(make<Integer>(value));
-                                        prev = PrevCategory::Operand;
-                                        continue;
-                                }
-                        }
+/** Tokenize the expression without throwing.
+	@return the tokens, or the error and its character offset.
+	@param expression [in] The expression to tokenize.
+	*/
+Expected<TokenList> Tokenizer::try_tokenize(string_type const& expression) {
+        TokenList tokenizedExpression;
+        Cursor cursor(expression, false);
+        Error error;
+        while (auto token = try_next_token(cursor, error))
+                tokenizedExpression.push_back(token);
+        if (error)
+                return error;
+        return tokenizedExpression;
+}
 
-                        auto number = _get_number(currentChar, expression);
-                        tokenizedExpression.push_back(number);
-                        prev = classify_prev(number);
-                        continue;
-                }
 
-                // check for 2-character operators
-#define CHECK_2OP( symbol1, symbol2, token )\
-                if( *currentChar == symbol1 ) {\
-                        auto nextChar = next(currentChar);\
-                        if( nextChar != end(expression) && *nextChar == symbol2 ) {\
-                                currentChar = next(nextChar);\
-                                auto tkn = make<token>();\
-                                tokenizedExpression.push_back( tkn );\
-                                prev = classify_prev(tkn);\
-                                continue;\
-                        }\
-                }
-                CHECK_2OP('<', '=', LessEqual)
-                CHECK_2OP('>', '=', GreaterEqual)
-                CHECK_2OP('=', '=', Equality)
-                CHECK_2OP('!', '=', Inequality)
-                CHECK_2OP('*', '*', Power)
-#undef CHECK_2OP
-
-                        // check for 1-character operators
-#define CHECK_OP(symbol, token)\
-                if( *currentChar == symbol ) {\
-                        ++currentChar;\
-                        auto tkn = make<token>();\
-                        tokenizedExpression.push_back( tkn );\
-                        prev = classify_prev(tkn);\
-                        continue;\
-                }
-                CHECK_OP('*', Multiplication)
-                CHECK_OP('/', Division)
-                CHECK_OP('%', Modulus)
-                CHECK_OP('(', LeftParenthesis)
-                CHECK_OP(')', RightParenthesis)
-                CHECK_OP(',', ArgumentSeparator)
-                CHECK_OP('<', Less)
-                CHECK_OP('>', Greater)
-#undef CHECK_OP
-
-                if (*currentChar == '!') {
-                        if (prev == PrevCategory::Operand || prev == PrevCategory::PostfixOp || prev == PrevCategory::RightParenthesis) {
-                                ++currentChar;
-                                auto tkn = make<Factorial>();
-                                tokenizedExpression.push_back(tkn);
-                                prev = classify_prev(tkn);
-                        } else {
-                                throw XTokenizer(expression, currentChar - begin(expression), "Factorial must follow Expression");
-                        }
-                        continue;
-                }
 
-                if (*currentChar == '=') {
-                        ++currentChar;
-                        auto tkn = make<Assignment>();
-                        tokenizedExpression.push_back(tkn);
-                        prev = classify_prev(tkn);
-                        continue;
-                }
+/** Get the next token of an expression.
+	@return the next token, or nullptr at the end of the expression.
+	@param cursor [in,out] the expression and the scanning position; advanced past the token.
+	@note Throws the same exceptions as tokenize().
+	*/
+Token::pointer_type Tokenizer::next_token(Cursor& cursor) {
+        Error error;
+        auto token = try_next_token(cursor, error);
+        if (error)
+                _throw(cursor, error);
+        return token;
+}
 
-                // check for multi-purpose operators
-                if (*currentChar == '+') {
-                        ++currentChar;
-                        Token::pointer_type tkn;
-                        if (prev == PrevCategory::Operand || prev == PrevCategory::PostfixOp || prev == PrevCategory::RightParenthesis)
-                                tkn = make<Addition>();
-                        else
-                                tkn = make<Identity>();
-                        tokenizedExpression.push_back(tkn);
-                        prev = classify_prev(tkn);
-                        continue;
-                }
-                if (*currentChar == '-') {
-                        ++currentChar;
-                        Token::pointer_type tkn;
-                        if (prev == PrevCategory::Operand || prev == PrevCategory::PostfixOp || prev == PrevCategory::RightParenthesis)
-                                tkn = make<Subtraction>();
-                        else
-                                tkn = make<Negation>();
-                        tokenizedExpression.push_back(tkn);
-                        prev = classify_prev(tkn);
-                        continue;
-                }
 
 
-                // Identifiers
-                if (isalpha(*currentChar)) {
-                        auto identToken = _get_identifier(currentChar, expression);
-                        if (is<Function>(identToken))
-                                expect_function_paren(currentChar);
-                        tokenizedExpression.push_back(identToken);
-                        prev = classify_prev(identToken);
-                        continue;
+/** Get the next token of an expression without throwing.
+	@return the next token, or nullptr at the end of the expression or on an error.
+	@param cursor [in,out] the expression and the scanning position; advanced past the token.
+	@param error [out] set to the error and its offset in the whole input, if any.
+	*/
+Token::pointer_type Tokenizer::try_next_token(Cursor& cursor, Error& error) {
+        auto const expression = cursor.expression_m;
+        auto& currentChar = cursor.current_m;
+
+        // strip whitespace
+        currentChar = skip<space_run_end>(currentChar, end(expression));
+
+        // check of end of expression
+        cursor.start_m = currentChar;
+        if (currentChar == end(expression))
+                return nullptr;
+
+        Transition const& transition = transitions_c[size_t(cursor.state_m)][size_t(char_class(*currentChar))];
+        switch (transition.action) {
+        case Action::Number:
+                cursor.state_m = State::ExpectOperator;
+                return _get_number(cursor, error);
+
+        case Action::Identifier: {
+                auto identToken = _get_identifier(cursor);
+                if (is<Function>(identToken)) {
+                        auto paren = skip<space_run_end>(currentChar, end(expression));
+                        if (paren == end(expression) || *paren != '(')
+                                return _fail(cursor, paren, ErrorCode::FunctionWithoutParenthesis, error);
                 }
+                cursor.state_m = is<Operand>(identToken) ? State::ExpectOperator : State::ExpectOperand;
+                return identToken;
+        }
 
-                // not a recognized token
-                throw XBadCharacter(expression, currentChar - begin(expression));
+        case Action::Operator: {
+                auto nextChar = next(currentChar);
+                if (transition.second != '\0' && nextChar != end(expression) && *nextChar == transition.second) {
+                        currentChar = next(nextChar);
+                        cursor.state_m = transition.pairNext;
+                        return transition.pair();
+                }
+                if (!transition.single)
+                        return _fail(cursor, currentChar, transition.error, error);
+                currentChar = nextChar;
+                cursor.state_m = transition.singleNext;
+                return transition.single();
         }
 
-        return tokenizedExpression;
+        case Action::BadCharacter:
+                break;
+        }
+
+        // not a recognized token
+        return _fail(cursor, currentChar, ErrorCode::BadCharacter, error);
+}
+
+
+
+/** Records an error at the character 'at'.
+	@return nullptr, for the caller to return.
+	*/
+Token::pointer_type Tokenizer::_fail(Cursor const& cursor, Cursor::iterator_type at, ErrorCode code, Error& error) {
+        error.code = code;
+        error.offset = cursor.base_m + size_t(at - cursor.expression_m.cbegin());
+        return nullptr;
+}
+
+
+
+/** Throws the exception for an error, with a copy of the text if the cursor keeps one. */
+void Tokenizer::_throw(Cursor const& cursor, Error const& error) {
+        if (error.code == ErrorCode::BadCharacter) {
+                if (cursor.copySource_m)
+                        throw XBadCharacter(string_type(cursor.expression_m), error.offset);
+                throw XBadCharacter(error.offset);
+        }
+        if (cursor.copySource_m)
+                throw XTokenizer(string_type(cursor.expression_m), error.offset, error.message());
+        throw XTokenizer(error.offset, error.message());
 }
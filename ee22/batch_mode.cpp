@@ -0,0 +1,292 @@
+/*!	\file	batch_mode.cpp
+	\brief	ee22 batch mode implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include "batch_mode.hpp"
+#include <ee/real.hpp>
+#include <ee/rule_set.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ios>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	constexpr size_t buffer_size_c = 1 << 20;
+
+	/*! Reads lines from a FILE in large blocks; a line may be longer than a block. */
+	class LineReader {
+		FILE*			in_m;
+		vector<char>	buffer_m = vector<char>(buffer_size_c);
+		size_t			begin_m = 0;
+		size_t			end_m = 0;
+		bool			eof_m = false;
+	public:
+		explicit LineReader(FILE* in) : in_m(in) { }
+
+		/*! Gets the next line, without its line terminator ("\n" or "\r\n").
+			@return false at the end of the input.
+			*/
+		[[nodiscard]] bool next(string_view& line) {
+			for (size_t scanned = begin_m;;) {
+				if (auto newline = static_cast<char const*>(memchr(buffer_m.data() + scanned, '\n', end_m - scanned))) {
+					line = _take(size_t(newline - buffer_m.data()), 1);
+					return true;
+				}
+				if (eof_m) {
+					if (begin_m == end_m)
+						return false;
+					line = _take(end_m, 0);
+					return true;
+				}
+				scanned = end_m - begin_m;
+				_fill();
+			}
+		}
+
+	private:
+		string_view _take(size_t last, size_t terminator) {
+			string_view line(buffer_m.data() + begin_m, last - begin_m);
+			if (!line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+			begin_m = last + terminator;
+			return line;
+		}
+
+		/*! Moves the partial line to the front, growing the buffer if it is full, then reads a block. */
+		void _fill() {
+			memmove(buffer_m.data(), buffer_m.data() + begin_m, end_m - begin_m);
+			end_m -= begin_m;
+			begin_m = 0;
+			if (end_m == buffer_m.size())
+				buffer_m.resize(buffer_m.size() * 2);
+			auto const count = fread(buffer_m.data() + end_m, 1, buffer_m.size() - end_m, in_m);
+			end_m += count;
+			eof_m = count == 0;
+		}
+	};
+
+	/*! Collects output and writes it to a FILE in large blocks. */
+	class BlockWriter {
+		FILE*	out_m;
+		string	buffer_m;
+	public:
+		explicit BlockWriter(FILE* out) : out_m(out) { buffer_m.reserve(buffer_size_c + 4096); }
+		~BlockWriter() { flush(); }
+
+		BlockWriter& operator << (string_view text) {
+			buffer_m += text;
+			flush_if_full();
+			return *this;
+		}
+
+		/*! Gets the buffer, to format into directly; call flush_if_full() afterwards. */
+		[[nodiscard]] string& buffer() { return buffer_m; }
+
+		void flush_if_full() {
+			if (buffer_m.size() >= buffer_size_c)
+				flush();
+		}
+
+		void flush() {
+			fwrite(buffer_m.data(), 1, buffer_m.size(), out_m);
+			buffer_m.clear();
+		}
+	};
+
+	/*! Writes the result line of an expression.
+		@return true if the line is an error.
+		*/
+	bool write_result(BlockWriter& writer, Token::pointer_type const& value, Error error) {
+		bool const failed = append_result(writer.buffer(), value, error);
+		writer.flush_if_full();
+		return failed;
+	}
+
+
+
+	/*! Gets the value at a percentile of unsorted samples (reorders them). */
+	[[nodiscard]] double percentile(vector<float>& samples, double fraction) {
+		if (samples.empty())
+			return 0.0;
+		auto nth = samples.begin() + ptrdiff_t(fraction * double(samples.size() - 1));
+		nth_element(samples.begin(), nth, samples.end());
+		return *nth;
+	}
+}
+
+
+
+/*!	Formats a result; reals are written with real_digits_c significant digits instead of all of them. */
+constexpr std::streamsize real_digits_c = 20;
+
+[[nodiscard]] static string format_result(Token::pointer_type result) {
+	if (is<Variable>(result))
+		result = convert<Variable>(result)->value();
+	if (is<Real>(result))
+		return value_of<Real>(result).str(real_digits_c);
+	return result->str();
+}
+
+
+
+bool append_result(string& out, Token::pointer_type const& value, Error error) {
+	// a lone uninitialized variable evaluates to itself
+	if (!error && is<Variable>(value) && !convert<Variable>(value)->value())
+		error = Error{ ErrorCode::VariableNotInitialized, 0 };
+
+	if (error) {
+		out += "error at ";
+		out += to_string(error.offset);
+		out += ": ";
+		out += error.message();
+	}
+	else if (value)
+		out += format_result(value);
+	out += '\n';
+	return bool(error);
+}
+
+
+
+[[nodiscard]] BatchStatistics run_batch(FILE* in, FILE* out, ExpressionEvaluator& evaluator) {
+	using clock_type = chrono::steady_clock;
+	BatchStatistics stats;
+	vector<float> latencies;		// microseconds, one per evaluated line
+	LineReader reader(in);
+	BlockWriter writer(out);
+
+	auto const start = clock_type::now();
+	string expression;
+	for (string_view line; reader.next(line); ) {
+		++stats.lines;
+		if (line.find_first_not_of(" \t") == string_view::npos) {
+			writer << "\n";
+			continue;
+		}
+
+		expression.assign(line);
+		auto const before = clock_type::now();
+		auto const result = evaluator.try_evaluate(expression);
+		latencies.push_back(chrono::duration<float, micro>(clock_type::now() - before).count());
+		if (write_result(writer, result ? *result : nullptr, result.error()))
+			++stats.errors;
+	}
+	writer.flush();
+	stats.seconds = chrono::duration<double>(clock_type::now() - start).count();
+	stats.p50 = percentile(latencies, 0.50);
+	stats.p99 = percentile(latencies, 0.99);
+	return stats;
+}
+
+
+
+[[nodiscard]] BatchStatistics run_batch(FILE* in, FILE* out, PipelineEvaluator& evaluator) {
+	BatchStatistics stats;
+	vector<float> latencies;
+	LineReader reader(in);
+	BlockWriter writer(out);
+
+	auto const pipeline = evaluator.run(
+		[&reader](string& line) {
+			string_view next;
+			if (!reader.next(next))
+				return false;
+			line.assign(next);
+			return true;
+		},
+		[&](PipelineEvaluator::Outcome const& outcome) {
+			if (write_result(writer, outcome.value, outcome.error))
+				++stats.errors;
+			if (outcome.value || outcome.error)
+				latencies.push_back(chrono::duration<float, micro>(outcome.latency).count());
+		});
+	writer.flush();
+
+	stats.lines = pipeline.lines;
+	stats.seconds = pipeline.seconds;
+	stats.p50 = percentile(latencies, 0.50);
+	stats.p99 = percentile(latencies, 0.99);
+	stats.queues = pipeline.queues;
+	return stats;
+}
+
+
+
+[[nodiscard]] int batch_main(string const& path, bool pipelined) {
+	FILE* in = path == "-" ? stdin : fopen(path.c_str(), "rb");
+	if (!in) {
+		fprintf(stderr, "ee22: cannot open '%s'\n", path.c_str());
+		return EXIT_FAILURE;
+	}
+
+	BatchStatistics stats;
+	if (pipelined) {
+		PipelineEvaluator evaluator;
+		stats = run_batch(in, stdout, evaluator);
+	}
+	else {
+		ExpressionEvaluator evaluator;
+		stats = run_batch(in, stdout, evaluator);
+	}
+	if (in != stdin)
+		fclose(in);
+	fflush(stdout);
+
+	fprintf(stderr, "%llu lines, %llu errors in %.3f s: %.0f lines/s, latency p50 %.2f us, p99 %.2f us\n",
+		static_cast<unsigned long long>(stats.lines), static_cast<unsigned long long>(stats.errors),
+		stats.seconds, stats.lines_per_second(), stats.p50, stats.p99);
+	for (auto const& queue : stats.queues)
+		fprintf(stderr, "  %-22s mean occupancy %8.1f / %zu, producer stalls %llu, consumer stalls %llu\n",
+			queue.name, queue.statistics.mean_occupancy(), queue.statistics.capacity,
+			static_cast<unsigned long long>(queue.statistics.producerStalls), static_cast<unsigned long long>(queue.statistics.consumerStalls));
+	return EXIT_SUCCESS;
+}
+
+
+
+[[nodiscard]] int compile_main(string const& path) {
+	try {
+		for (unsigned threads : { 1u, 4u, 16u, 64u }) {
+			auto const rules = RuleSet::load(path, threads);
+			auto const& stats = rules.statistics();
+			fprintf(stderr, "%2u threads: %8.1f ms, %.0f rules/s (%llu rules, %llu errors, %zu chunks, %zu variables)\n",
+				stats.threads, stats.seconds * 1000.0, stats.rules_per_second(),
+				static_cast<unsigned long long>(stats.rules), static_cast<unsigned long long>(stats.errors),
+				stats.chunks, rules.symbols()->size());
+		}
+	}
+	catch (exception const& e) {
+		fprintf(stderr, "ee22: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
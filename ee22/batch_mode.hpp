@@ -0,0 +1,79 @@
+#pragma once
+/*!	\file	batch_mode.hpp
+	\brief	ee22 batch mode declarations.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Batch mode of the ee22 application: evaluates a file of
+expressions, one per line, and reports throughput and latency.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/pipeline_evaluator.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+/*! Counters and latency percentiles of a batch run. */
+struct BatchStatistics {
+	std::uint64_t	lines = 0;
+	std::uint64_t	errors = 0;
+	double			seconds = 0.0;		/// wall time of the whole run, I/O included.
+	double			p50 = 0.0;			/// median evaluation latency, in microseconds.
+	double			p99 = 0.0;			/// 99th percentile evaluation latency, in microseconds.
+	std::vector<PipelineEvaluator::QueueReport>	queues;		/// pipelined runs only.
+
+	[[nodiscard]] double lines_per_second() const { return seconds > 0.0 ? double(lines) / seconds : 0.0; }
+};
+
+
+/*!	Appends the result line of an expression to 'out': empty if there is no value, else the value
+	or "error at <offset>: <message>".
+	@return true if the line is an error.
+	*/
+bool append_result(std::string& out, Token::pointer_type const& value, Error error);
+
+/*!	Evaluates each line of 'in' with 'evaluator', writing one result line per input line to 'out'.
+	Variables persist from line to line.  An empty line gives an empty result line; a line that
+	fails gives "error at <offset>: <message>".
+	*/
+[[nodiscard]] BatchStatistics run_batch(std::FILE* in, std::FILE* out, ExpressionEvaluator& evaluator);
+
+/*!	As run_batch() above, with reading, tokenizing, parsing and evaluating overlapped on separate threads.
+	The latency is measured from reading a line to evaluating it, so it includes the time spent queued.
+	*/
+[[nodiscard]] BatchStatistics run_batch(std::FILE* in, std::FILE* out, PipelineEvaluator& evaluator);
+
+/*!	Runs batch mode on a file, or on standard input if 'path' is "-", writing to standard output.
+	The statistics, and the queue usage of a pipelined run, are reported on standard error.
+	@return the process exit code; lines that fail to evaluate are reported in the output, not the exit code.
+	*/
+[[nodiscard]] int batch_main(std::string const& path, bool pipelined = false);
+
+/*!	Compiles a rule file with RuleSet::load() at 1, 4, 16 and 64 threads, reporting the startup time of each.
+	@return the process exit code: failure if the file can't be read.
+	*/
+[[nodiscard]] int compile_main(std::string const& path);
@@ -0,0 +1,572 @@
+/*!	\file	cluster_mode.cpp
+	\brief	ee22 coordinator/worker mode implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+
+#include "cluster_mode.hpp"
+#include "batch_mode.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__linux__)
+	#include <ee/expression_evaluator.hpp>
+	#include <ee/mapped_file.hpp>
+	#include <cerrno>
+	#include <chrono>
+	#include <csignal>
+	#include <cstring>
+	#include <deque>
+	#include <functional>
+	#include <iostream>
+	#include <iterator>
+	#include <memory>
+	#include <stdexcept>
+	#include <string_view>
+	#include <system_error>
+	#include <vector>
+
+	#include <arpa/inet.h>
+	#include <fcntl.h>
+	#include <netinet/in.h>
+	#include <netinet/tcp.h>
+	#include <poll.h>
+	#include <sys/prctl.h>
+	#include <sys/socket.h>
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+using namespace std;
+
+
+
+#if defined(__linux__)
+namespace {
+	constexpr size_t read_size_c = 64 * 1024;
+	constexpr size_t window_c = 4;				/// tasks a worker may have unanswered.
+	constexpr unsigned max_restarts_c = 16;		/// restarts of one worker without an answered task before the run fails.
+	constexpr int startup_timeout_c = 10'000;	/// milliseconds for a new worker to report its port.
+
+	[[noreturn]] void throw_errno(char const* what) {
+		throw system_error(errno, generic_category(), what);
+	}
+
+	volatile sig_atomic_t stopWorker = 0;
+
+	extern "C" void on_stop_signal(int) {
+		stopWorker = 1;
+	}
+
+	/*! Takes the first line of 'buffer' from 'position' on, without its terminator. */
+	[[nodiscard]] bool next_line(string_view buffer, size_t& position, string_view& line) {
+		auto const end = buffer.find('\n', position);
+		if (end == string_view::npos)
+			return false;
+		line = buffer.substr(position, end - position);
+		position = end + 1;
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		return true;
+	}
+
+	/*! Parses "<tag> <number>..." task and result headers. */
+	[[nodiscard]] bool parse_header(string_view line, char tag, uint64_t* numbers, size_t count) {
+		if (line.size() < 2 || line[0] != tag || line[1] != ' ')
+			return false;
+		string const text(line.substr(2));
+		char const* cursor = text.c_str();
+		for (size_t i = 0; i < count; ++i) {
+			char* end = nullptr;
+			errno = 0;
+			numbers[i] = strtoull(cursor, &end, 10);
+			if (end == cursor || errno != 0)
+				return false;
+			cursor = end;
+		}
+		return *cursor == '\0';
+	}
+
+	void send_all(int fd, string_view data) {
+		while (!data.empty()) {
+			auto const sent = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+			if (sent < 0) {
+				if (errno == EINTR)
+					continue;
+				throw_errno("send");
+			}
+			data.remove_prefix(size_t(sent));
+		}
+	}
+
+
+
+	/*!	Worker side of the protocol.
+		A task is "T <id> <count>" followed by 'count' expression lines; its answer is
+		"R <id> <count> <errors>" followed by one result line per expression.
+		*/
+	void serve_connection(int fd) {
+		string input, output;
+		size_t position = 0;
+		char block[read_size_c];
+		for (;;) {
+			// answer every complete task in the input
+			for (;;) {
+				size_t cursor = position;
+				string_view header;
+				if (!next_line(input, cursor, header))
+					break;
+				uint64_t fields[2];
+				if (!parse_header(header, 'T', fields, 2))
+					throw runtime_error("bad task header");
+				vector<string_view> lines(fields[1]);
+				bool complete = true;
+				for (auto& line : lines)
+					if (!next_line(input, cursor, line)) {
+						complete = false;
+						break;
+					}
+				if (!complete)
+					break;
+				position = cursor;
+
+				string results;
+				uint64_t errors = 0;
+				for (auto line : lines) {
+					if (line.find_first_not_of(" \t") == string_view::npos) {
+						results += '\n';
+						continue;
+					}
+					ExpressionEvaluator evaluator;
+					auto const result = evaluator.try_evaluate(string(line));
+					if (append_result(results, result ? *result : nullptr, result.error()))
+						++errors;
+				}
+				output += "R " + to_string(fields[0]) + ' ' + to_string(fields[1]) + ' ' + to_string(errors) + '\n';
+				output += results;
+			}
+			if (!output.empty()) {
+				send_all(fd, output);
+				output.clear();
+			}
+			input.erase(0, position);
+			position = 0;
+
+			auto const received = ::recv(fd, block, sizeof(block), 0);
+			if (received == 0)
+				return;
+			if (received < 0) {
+				if (errno == EINTR && !stopWorker)
+					continue;
+				if (errno == EINTR)
+					return;
+				throw_errno("recv");
+			}
+			input.append(block, size_t(received));
+		}
+	}
+
+
+
+	/*! A group of lines of one worker, sent and answered as a unit. */
+	struct Task {
+		vector<size_t>	rows;
+	};
+
+	/*! A worker process and its connection; the coordinator owns all of it. */
+	struct Worker {
+		pid_t			pid = -1;
+		int				fd = -1;
+		deque<size_t>	queued;			/// tasks not yet sent.
+		deque<size_t>	sent;			/// tasks sent and not yet answered, in order.
+		string			input;			/// received text not yet parsed.
+		string			output;			/// task text not yet sent.
+		unsigned		restarts = 0;	/// restarts since the worker last answered a task.
+	};
+
+
+
+	/*! Starts the worker processes, feeds them their tasks, and collects the results. */
+	class Coordinator {
+		ClusterOptions				options_m;
+		vector<string_view>			lines_m;
+		vector<string>				results_m;
+		vector<Task>				tasks_m;
+		vector<Worker>				workers_m;
+		size_t						remaining_m = 0;		/// tasks not yet answered.
+		ClusterStatistics			stats_m;
+
+	public:
+		Coordinator(ClusterOptions const& options, vector<string_view> lines)
+			: options_m(options), lines_m(move(lines)), results_m(lines_m.size()) { }
+		~Coordinator() { _shutdown(); }
+
+		/*! Evaluates every line; the results are then available from results(). */
+		ClusterStatistics run() {
+			using clock_type = chrono::steady_clock;
+			auto const start = clock_type::now();
+			_partition();
+			for (auto& worker : workers_m)
+				_start(worker);
+
+			vector<pollfd> polls(workers_m.size());
+			while (remaining_m > 0) {
+				for (size_t i = 0; i < workers_m.size(); ++i) {
+					_fill(workers_m[i]);
+					polls[i] = pollfd{ workers_m[i].fd, short(POLLIN | (workers_m[i].output.empty() ? 0 : POLLOUT)), 0 };
+				}
+				if (::poll(polls.data(), nfds_t(polls.size()), -1) < 0) {
+					if (errno == EINTR)
+						continue;
+					throw_errno("poll");
+				}
+				for (size_t i = 0; i < workers_m.size(); ++i) {
+					auto& worker = workers_m[i];
+					bool ok = true;
+					if (polls[i].revents & (POLLIN | POLLHUP | POLLERR))
+						ok = _read(worker);
+					if (ok && (polls[i].revents & POLLOUT))
+						ok = _flush(worker);
+					if (!ok)
+						_restart(worker);
+				}
+			}
+			_shutdown();
+			stats_m.lines = lines_m.size();
+			stats_m.tasks = tasks_m.size();
+			stats_m.seconds = chrono::duration<double>(clock_type::now() - start).count();
+			return stats_m;
+		}
+
+		[[nodiscard]] vector<string> const& results() const { return results_m; }
+
+	private:
+		/*! Assigns every line to a worker, and groups each worker's lines into tasks. */
+		void _partition() {
+			workers_m.resize(options_m.workers);
+			vector<vector<size_t>> shards(options_m.workers);
+			for (size_t row = 0; row < lines_m.size(); ++row) {
+				size_t const shard = options_m.partition == Partition::Hash
+					? hash<string_view>{}(lines_m[row]) % options_m.workers
+					: row * options_m.workers / lines_m.size();
+				shards[shard].push_back(row);
+			}
+			for (size_t w = 0; w < shards.size(); ++w)
+				for (size_t first = 0; first < shards[w].size(); first += options_m.taskSize) {
+					auto const begin = shards[w].begin() + ptrdiff_t(first);
+					auto const end = shards[w].begin() + ptrdiff_t(min(first + options_m.taskSize, shards[w].size()));
+					workers_m[w].queued.push_back(tasks_m.size());
+					tasks_m.push_back(Task{ vector<size_t>(begin, end) });
+				}
+			remaining_m = tasks_m.size();
+		}
+
+		/*! Starts a worker process and connects to it. */
+		void _start(Worker& worker) {
+			int channel[2];
+			if (pipe2(channel, O_CLOEXEC) != 0)
+				throw_errno("pipe2");
+			pid_t const parent = getpid();
+			pid_t const pid = fork();
+			if (pid < 0)
+				throw_errno("fork");
+			if (pid == 0) {
+				// the child reports its port through the pipe, and dies with the coordinator
+				dup2(channel[1], STDOUT_FILENO);
+				prctl(PR_SET_PDEATHSIG, SIGTERM);
+				if (getppid() != parent)
+					_exit(EXIT_FAILURE);
+				char program[] = "ee22", option[] = "--worker", address[] = "tcp:0";
+				char* argv[] = { program, option, address, nullptr };
+				execv("/proc/self/exe", argv);
+				_exit(EXIT_FAILURE);
+			}
+			::close(channel[1]);
+			worker.pid = pid;
+
+			string announcement;
+			for (char c; announcement.find('\n') == string::npos; ) {
+				pollfd wait{ channel[0], POLLIN, 0 };
+				if (::poll(&wait, 1, startup_timeout_c) <= 0 || ::read(channel[0], &c, 1) != 1) {
+					::close(channel[0]);
+					throw runtime_error("a worker failed to start");
+				}
+				announcement += c;
+			}
+			::close(channel[0]);
+
+			auto const colon = announcement.rfind(':');
+			sockaddr_in remote{};
+			remote.sin_family = AF_INET;
+			remote.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			remote.sin_port = htons(uint16_t(stoul(announcement.substr(colon + 1))));
+			worker.fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+			if (worker.fd < 0)
+				throw_errno("socket");
+			if (connect(worker.fd, reinterpret_cast<sockaddr*>(&remote), sizeof(remote)) != 0)
+				throw_errno("connect");
+			int const on = 1;
+			setsockopt(worker.fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+			fcntl(worker.fd, F_SETFL, fcntl(worker.fd, F_GETFL) | O_NONBLOCK);
+		}
+
+		/*! Kills a failed worker, starts another, and queues its unanswered tasks again, in order. */
+		void _restart(Worker& worker) {
+			if (++worker.restarts > max_restarts_c)
+				throw runtime_error("a worker failed " + to_string(max_restarts_c) + " times in a row");
+			++stats_m.restarts;
+			stats_m.retried += worker.sent.size();
+			worker.queued.insert(worker.queued.begin(), worker.sent.begin(), worker.sent.end());
+			worker.sent.clear();
+			worker.input.clear();
+			worker.output.clear();
+			_stop(worker, SIGKILL);
+			_start(worker);
+		}
+
+		void _stop(Worker& worker, int signal) {
+			if (worker.fd >= 0) {
+				::close(worker.fd);
+				worker.fd = -1;
+			}
+			if (worker.pid > 0) {
+				kill(worker.pid, signal);
+				waitpid(worker.pid, nullptr, 0);
+				worker.pid = -1;
+			}
+		}
+
+		/*! Moves queued tasks to the output, up to the window. */
+		void _fill(Worker& worker) {
+			while (worker.sent.size() < window_c && !worker.queued.empty()) {
+				auto const id = worker.queued.front();
+				worker.queued.pop_front();
+				worker.sent.push_back(id);
+				auto const& rows = tasks_m[id].rows;
+				worker.output += "T " + to_string(id) + ' ' + to_string(rows.size()) + '\n';
+				for (auto row : rows) {
+					worker.output += lines_m[row];
+					worker.output += '\n';
+				}
+			}
+		}
+
+		/*! @return false if the worker failed. */
+		bool _flush(Worker& worker) {
+			while (!worker.output.empty()) {
+				auto const sent = ::send(worker.fd, worker.output.data(), worker.output.size(), MSG_NOSIGNAL);
+				if (sent < 0)
+					return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+				worker.output.erase(0, size_t(sent));
+			}
+			return true;
+		}
+
+		/*! Takes the answers received from a worker.  @return false if the worker failed. */
+		bool _read(Worker& worker) {
+			char block[read_size_c];
+			for (;;) {
+				auto const received = ::recv(worker.fd, block, sizeof(block), 0);
+				if (received == 0)
+					return false;
+				if (received < 0) {
+					if (errno == EAGAIN || errno == EWOULDBLOCK)
+						break;
+					if (errno == EINTR)
+						continue;
+					return false;
+				}
+				worker.input.append(block, size_t(received));
+			}
+
+			size_t position = 0;
+			for (;;) {
+				size_t cursor = position;
+				string_view header;
+				if (!next_line(worker.input, cursor, header))
+					break;
+				uint64_t fields[3];
+				if (!parse_header(header, 'R', fields, 3) || worker.sent.empty() || fields[0] != worker.sent.front())
+					return false;
+				auto const& rows = tasks_m[worker.sent.front()].rows;
+				if (fields[1] != rows.size())
+					return false;
+				vector<string_view> answers(rows.size());
+				bool complete = true;
+				for (auto& answer : answers)
+					if (!next_line(worker.input, cursor, answer)) {
+						complete = false;
+						break;
+					}
+				if (!complete)
+					break;
+				position = cursor;
+
+				for (size_t i = 0; i < rows.size(); ++i)
+					results_m[rows[i]] = answers[i];
+				stats_m.errors += fields[2];
+				worker.sent.pop_front();
+				worker.restarts = 0;
+				--remaining_m;
+				_chaos();
+			}
+			worker.input.erase(0, position);
+			return true;
+		}
+
+		/*! Testing: kills the worker with the most unanswered tasks after every 'killEvery' answered tasks. */
+		void _chaos() {
+			auto const answered = tasks_m.size() - remaining_m;
+			if (options_m.killEvery == 0 || answered % options_m.killEvery != 0 || remaining_m == 0)
+				return;
+			auto victim = workers_m.begin();
+			for (auto iter = workers_m.begin(); iter != workers_m.end(); ++iter)
+				if (iter->sent.size() > victim->sent.size())
+					victim = iter;
+			if (victim->pid > 0)
+				kill(victim->pid, SIGKILL);
+		}
+
+		void _shutdown() {
+			for (auto& worker : workers_m)
+				_stop(worker, SIGTERM);
+		}
+	};
+
+
+
+	[[nodiscard]] vector<string_view> split_lines(string_view text) {
+		vector<string_view> lines;
+		for (size_t position = 0; position < text.size(); ) {
+			string_view line;
+			if (!next_line(text, position, line)) {
+				line = text.substr(position);
+				position = text.size();
+			}
+			lines.push_back(line);
+		}
+		return lines;
+	}
+}
+
+
+
+[[nodiscard]] int worker_main(string const& address) {
+	try {
+		if (address.rfind("tcp:", 0) != 0)
+			throw invalid_argument("bad worker address '" + address + "'");
+		struct sigaction action{};
+		action.sa_handler = on_stop_signal;
+		sigaction(SIGINT, &action, nullptr);
+		sigaction(SIGTERM, &action, nullptr);
+
+		sockaddr_in local{};
+		local.sin_family = AF_INET;
+		local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		local.sin_port = htons(uint16_t(stoul(address.substr(4))));
+		int const listener = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (listener < 0)
+			throw_errno("socket");
+		int const on = 1;
+		setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+		if (::bind(listener, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0 || listen(listener, 4) != 0)
+			throw_errno("bind");
+		socklen_t length = sizeof(local);
+		getsockname(listener, reinterpret_cast<sockaddr*>(&local), &length);
+		printf("tcp:127.0.0.1:%u\n", unsigned(ntohs(local.sin_port)));
+		fflush(stdout);
+
+		while (!stopWorker) {
+			int const fd = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+			if (fd < 0) {
+				if (errno == EINTR)
+					continue;
+				throw_errno("accept4");
+			}
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+			try {
+				serve_connection(fd);
+			}
+			catch (exception const& e) {
+				fprintf(stderr, "ee22 worker: %s\n", e.what());
+			}
+			::close(fd);
+		}
+		::close(listener);
+	}
+	catch (exception const& e) {
+		fprintf(stderr, "ee22: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+
+
+[[nodiscard]] int coordinate_main(ClusterOptions const& options) {
+	try {
+		if (options.workers == 0 || options.taskSize == 0)
+			throw invalid_argument("the worker count and task size must be positive");
+
+		string text;
+		unique_ptr<MappedFile> file;
+		if (options.input == "-")
+			text.assign(istreambuf_iterator<char>(cin), istreambuf_iterator<char>());
+		else
+			file = make_unique<MappedFile>(options.input);
+		auto lines = split_lines(file ? file->view() : string_view(text));
+
+		Coordinator coordinator(options, move(lines));
+		auto const stats = coordinator.run();
+
+		string output;
+		for (auto const& result : coordinator.results()) {
+			output += result;
+			output += '\n';
+		}
+		fwrite(output.data(), 1, output.size(), stdout);
+		fflush(stdout);
+
+		fprintf(stderr, "%llu lines, %llu errors in %llu tasks on %u workers (%s partition), %llu restarts, %llu tasks retried, %.3f s\n",
+			static_cast<unsigned long long>(stats.lines), static_cast<unsigned long long>(stats.errors),
+			static_cast<unsigned long long>(stats.tasks), options.workers,
+			options.partition == Partition::Hash ? "hash" : "range",
+			static_cast<unsigned long long>(stats.restarts), static_cast<unsigned long long>(stats.retried), stats.seconds);
+	}
+	catch (exception const& e) {
+		fprintf(stderr, "ee22: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+#else
+[[nodiscard]] int worker_main(std::string const&) {
+	fprintf(stderr, "ee22: --worker is only available on Linux\n");
+	return EXIT_FAILURE;
+}
+
+[[nodiscard]] int coordinate_main(ClusterOptions const&) {
+	fprintf(stderr, "ee22: --coordinate is only available on Linux\n");
+	return EXIT_FAILURE;
+}
+#endif
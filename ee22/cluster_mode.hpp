@@ -0,0 +1,80 @@
+#pragma once
+/*!	\file	cluster_mode.hpp
+	\brief	ee22 coordinator/worker mode declarations.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Coordinator/worker mode of the ee22 application: a coordinator
+partitions the lines of a batch across worker processes, which
+evaluate them and answer over TCP.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/*! How the coordinator assigns lines to workers. */
+enum class Partition {
+	Hash,		/// by a hash of the expression text: equal expressions go to the same worker.
+	Range		/// by line number: each worker gets one contiguous range.
+};
+
+
+/*! Coordinator settings. */
+struct ClusterOptions {
+	std::string		input;					/// a batch file, or "-" for standard input.
+	unsigned		workers = 4;			/// worker processes started on localhost.
+	Partition		partition = Partition::Hash;
+	std::size_t		taskSize = 256;			/// lines sent to a worker in one task, at most.
+	std::size_t		killEvery = 0;			/// testing: kill a busy worker after every n completed tasks; 0 never.
+};
+
+
+/*! Coordinator counters, reported when the run ends. */
+struct ClusterStatistics {
+	std::uint64_t	lines = 0;
+	std::uint64_t	errors = 0;
+	std::uint64_t	tasks = 0;
+	std::uint64_t	restarts = 0;			/// workers restarted after they failed.
+	std::uint64_t	retried = 0;			/// tasks sent again because their worker failed.
+	double			seconds = 0.0;
+};
+
+
+/*!	Runs a worker on "tcp:<port>" (port 0: any free port) until SIGINT or SIGTERM (Linux only).
+	The address is written on standard output once the worker is listening.  Connections are served
+	one at a time; each task is a numbered group of lines, answered with one result line per line.
+	Every line is evaluated on its own: variables don't carry from one line to the next.
+	@return the process exit code.
+	*/
+[[nodiscard]] int worker_main(std::string const& address);
+
+/*!	Evaluates a batch on worker processes started on localhost (Linux only), writing the results to
+	standard output in input order, formatted as in batch mode.  The lines are partitioned among the
+	workers and sent in tasks of at most 'taskSize' lines.  A worker that fails is restarted and
+	receives its unanswered tasks again, so no line is lost or answered twice.
+	@return the process exit code.
+	*/
+[[nodiscard]] int coordinate_main(ClusterOptions const& options);
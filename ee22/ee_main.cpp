@@ -8,6 +8,13 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.17
+	Added batch mode: ee22 --batch file|- [--pipeline]
+	Added rule file compile timing: ee22 --compile file
+	Added server mode: ee22 --serve socket|tcp:port [--workers n] [--queue lines] [--deadline ms] [limits]
+	Added shared-memory mode: ee22 --shm-serve name rules [--workers n], ee22 --shm-bench name socket rules [n]
+	Added coordinator/worker mode: ee22 --coordinate file|- [options], ee22 --worker tcp:port
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -43,11 +50,18 @@ the program(s) have been supplied.
 ============================================================= */
 
 #include <gats/ConsoleApp.hpp>
+#include "batch_mode.hpp"
+#include "cluster_mode.hpp"
+#include "server_mode.hpp"
+#include "shm_mode.hpp"
 #include <ee/expression_evaluator.hpp>
 #include <ee/function.hpp>
 #include <ee/real.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <regex>
@@ -59,6 +73,96 @@ using namespace std;
 
 
 MAKEAPP(ee) {
+	auto const& args = get_args();
+	if (args.size() > 1 && args[1] == "--batch") {
+		bool const pipelined = args.size() == 4 && args[3] == "--pipeline";
+		if (args.size() != 3 && !pipelined) {
+			cerr << "usage: ee22 --batch file|- [--pipeline]\n";
+			return EXIT_FAILURE;
+		}
+		return batch_main(args[2], pipelined);
+	}
+	if (args.size() > 1 && args[1] == "--compile") {
+		if (args.size() != 3) {
+			cerr << "usage: ee22 --compile file\n";
+			return EXIT_FAILURE;
+		}
+		return compile_main(args[2]);
+	}
+	if (args.size() > 1 && args[1] == "--serve") {
+		ServerOptions options;
+		bool valid = args.size() >= 3 && args.size() % 2 == 1;
+		for (size_t i = 3; valid && i + 1 < args.size(); i += 2) {
+			auto const& value = args[i + 1];
+			if (args[i] == "--workers")
+				valid = (options.workers = unsigned(atoi(value.c_str()))) > 0;
+			else if (args[i] == "--queue")
+				valid = (options.maxQueued = size_t(atoll(value.c_str()))) > 0;
+			else if (args[i] == "--deadline")
+				options.deadlineMs = unsigned(atoi(value.c_str()));
+			else if (args[i] == "--max-steps")
+				options.limits.maxSteps = uint64_t(atoll(value.c_str()));
+			else if (args[i] == "--max-digits")
+				options.limits.maxDigits = size_t(atoll(value.c_str()));
+			else if (args[i] == "--time-limit")
+				options.limits.timeLimit = chrono::milliseconds(atoi(value.c_str()));
+			else
+				valid = false;
+		}
+		if (!valid) {
+			cerr << "usage: ee22 --serve socket|tcp:port [--workers n] [--queue lines] [--deadline ms]\n"
+				"                  [--max-steps n] [--max-digits n] [--time-limit ms]\n";
+			return EXIT_FAILURE;
+		}
+		options.address = args[2];
+		return serve_main(options);
+	}
+	if (args.size() > 1 && args[1] == "--shm-serve") {
+		bool const withWorkers = args.size() == 6 && args[4] == "--workers";
+		if (args.size() != 4 && !withWorkers) {
+			cerr << "usage: ee22 --shm-serve name rules [--workers n]\n";
+			return EXIT_FAILURE;
+		}
+		return shm_serve_main(args[2], args[3], withWorkers ? unsigned(atoi(args[5].c_str())) : 0u);
+	}
+	if (args.size() > 1 && args[1] == "--shm-bench") {
+		if (args.size() != 5 && args.size() != 6) {
+			cerr << "usage: ee22 --shm-bench name socket rules [round trips]\n";
+			return EXIT_FAILURE;
+		}
+		return shm_bench_main(args[2], args[3], args[4], args.size() == 6 ? size_t(atoll(args[5].c_str())) : size_t(100'000));
+	}
+	if (args.size() > 1 && args[1] == "--worker") {
+		if (args.size() != 3) {
+			cerr << "usage: ee22 --worker tcp:port\n";
+			return EXIT_FAILURE;
+		}
+		return worker_main(args[2]);
+	}
+	if (args.size() > 1 && args[1] == "--coordinate") {
+		ClusterOptions options;
+		bool valid = args.size() >= 3 && args.size() % 2 == 1;
+		for (size_t i = 3; valid && i + 1 < args.size(); i += 2) {
+			auto const& value = args[i + 1];
+			if (args[i] == "--workers")
+				valid = (options.workers = unsigned(atoi(value.c_str()))) > 0;
+			else if (args[i] == "--task-size")
+				valid = (options.taskSize = size_t(atoll(value.c_str()))) > 0;
+			else if (args[i] == "--kill-every")
+				options.killEvery = size_t(atoll(value.c_str()));
+			else if (args[i] == "--partition" && (value == "hash" || value == "range"))
+				options.partition = value == "hash" ? Partition::Hash : Partition::Range;
+			else
+				valid = false;
+		}
+		if (!valid) {
+			cerr << "usage: ee22 --coordinate file|- [--workers n] [--partition hash|range] [--task-size n] [--kill-every n]\n";
+			return EXIT_FAILURE;
+		}
+		options.input = args[2];
+		return coordinate_main(options);
+	}
+
 	cout << "Expression Evaluator, (c) 1998-2024 Garth Santor\n";
 	for (unsigned count = 0; ; ++count) {
 		cout << "> ";
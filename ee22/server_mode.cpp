@@ -0,0 +1,630 @@
+/*!	\file	server_mode.cpp
+	\brief	ee22 server mode implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+
+#include "server_mode.hpp"
+#include "batch_mode.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__linux__)
+	#include <ee/admission.hpp>
+	#include <ee/expression_evaluator.hpp>
+	#include <algorithm>
+	#include <array>
+	#include <atomic>
+	#include <cerrno>
+	#include <chrono>
+	#include <condition_variable>
+	#include <cstring>
+	#include <cstdint>
+	#include <deque>
+	#include <memory>
+	#include <mutex>
+	#include <string_view>
+	#include <system_error>
+	#include <thread>
+	#include <unordered_map>
+	#include <vector>
+
+	#include <arpa/inet.h>
+	#include <netinet/in.h>
+	#include <netinet/tcp.h>
+	#include <signal.h>
+	#include <sys/epoll.h>
+	#include <sys/eventfd.h>
+	#include <sys/signalfd.h>
+	#include <sys/socket.h>
+	#include <sys/stat.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+using namespace std;
+
+
+
+#if defined(__linux__)
+namespace {
+	constexpr size_t read_size_c = 64 * 1024;
+	constexpr size_t max_line_c = 1 << 20;		/// longer lines end the session.
+	constexpr int max_events_c = 64;
+
+	[[noreturn]] void throw_errno(char const* what) {
+		throw system_error(errno, generic_category(), what);
+	}
+
+	using clock_type = chrono::steady_clock;
+
+	/*! A line and its admission decision. */
+	struct Request {
+		string					text;				/// the expression; or the answer, if not admitted.
+		clock_type::time_point	deadline;			/// time_point::max() for none.
+		Priority				priority;
+		bool					admitted;
+	};
+
+	/*! A client connection, with its own variables.
+		While 'busy', a worker owns 'batch', 'results', 'errors', 'expired', 'evaluated' and 'evaluator'; the I/O thread owns the rest.
+		*/
+	struct Session {
+		int					fd;
+		ExpressionEvaluator	evaluator;
+		Priority			priority = Priority::Normal;
+		chrono::milliseconds deadline;			/// allowed from arrival to evaluation; zero for none.
+		string				input;				/// received text after the last complete line.
+		vector<Request>		pending;			/// complete lines waiting for a worker.
+		vector<Request>		batch;				/// lines being evaluated.
+		string				results;			/// result lines of the batch.
+		uint64_t			errors = 0;			/// errors in the batch.
+		uint64_t			expired = 0;		/// lines of the batch that missed their deadline.
+		uint64_t			evaluated = 0;		/// admitted lines of the batch the worker reached.
+		uint64_t			backlog = 0;		/// admitted lines no worker has reached yet.
+		string				output;				/// results not yet sent.
+		bool				busy = false;
+		bool				eof = false;		/// the client has finished sending.
+		bool				closed = false;		/// the connection is gone; results are dropped.
+		bool				writing = false;	/// waiting for the socket to accept more output.
+
+		Session(int socket, chrono::milliseconds defaultDeadline) : fd(socket), deadline(defaultDeadline) { }
+	};
+	using session_pointer = shared_ptr<Session>;
+
+
+
+	/*! The epoll loop runs on the calling thread; evaluation runs on the worker threads. */
+	class Server {
+		ServerOptions						options_m;
+		int									listen_m = -1;
+		int									epoll_m = -1;
+		int									wake_m = -1;		/// eventfd: batches finished.
+		int									signal_m = -1;		/// signalfd: SIGINT, SIGTERM.
+		string								unixPath_m;
+		unordered_map<int, session_pointer>	sessions_m;
+		ServerStatistics					stats_m;
+
+		unsigned							workerCount_m = 1;
+		array<atomic<uint64_t>, priority_count_c>	waiting_m{};	/// admitted lines not yet taken by a worker, by class.
+		atomic<double>						lineSeconds_m{ 0.0 };	/// moving average of the evaluation time per line.
+
+		mutex								mutex_m;			/// guards the members below.
+		condition_variable					work_m;
+		array<deque<session_pointer>, priority_count_c>	ready_m;	/// by class, highest first.
+		array<atomic<size_t>, priority_count_c>		readySizes_m{};	/// sizes of ready_m, read without the lock.
+		vector<session_pointer>				done_m;
+		bool								stopping_m = false;
+		vector<thread>						workers_m;
+
+	public:
+		explicit Server(ServerOptions const& options) : options_m(options) { }
+		~Server() { _shutdown(); }
+
+		ServerStatistics run() {
+			_listen();
+			_start();
+			epoll_event events[max_events_c];
+			for (bool stop = false; !stop; ) {
+				int const count = epoll_wait(epoll_m, events, max_events_c, -1);
+				if (count < 0) {
+					if (errno == EINTR)
+						continue;
+					throw_errno("epoll_wait");
+				}
+				for (int i = 0; i < count; ++i) {
+					int const fd = events[i].data.fd;
+					if (fd == listen_m)
+						_accept();
+					else if (fd == wake_m)
+						_complete();
+					else if (fd == signal_m)
+						stop = true;
+					else if (auto iter = sessions_m.find(fd); iter != sessions_m.end()) {
+						auto session = iter->second;
+						if (session->eof && (events[i].events & (EPOLLHUP | EPOLLERR)))
+							_close(*session);		// nowhere left to send the results
+						else if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+							_read(*session);
+						if (!session->closed && (events[i].events & EPOLLOUT))
+							_flush(*session);
+						_schedule(session);
+						_close_if_finished(*session);
+					}
+				}
+			}
+			_shutdown();
+			return stats_m;
+		}
+
+	private:
+		void _watch(int fd, uint32_t events, int operation = EPOLL_CTL_ADD) {
+			epoll_event event{};
+			event.events = events;
+			event.data.fd = fd;
+			if (epoll_ctl(epoll_m, operation, fd, &event) != 0)
+				throw_errno("epoll_ctl");
+		}
+
+		/*! Gets the events a session waits for: input until the client finishes sending, output while blocked. */
+		[[nodiscard]] static uint32_t _session_events(Session const& session) {
+			return (session.eof ? 0u : uint32_t(EPOLLIN | EPOLLRDHUP)) | (session.writing ? uint32_t(EPOLLOUT) : 0u);
+		}
+
+		void _listen() {
+			epoll_m = epoll_create1(EPOLL_CLOEXEC);
+			if (epoll_m < 0)
+				throw_errno("epoll_create1");
+
+			auto const& address = options_m.address;
+			if (address.rfind("tcp:", 0) == 0) {
+				sockaddr_in local{};
+				local.sin_family = AF_INET;
+				local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+				local.sin_port = htons(uint16_t(stoul(address.substr(4))));
+				listen_m = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+				if (listen_m < 0)
+					throw_errno("socket");
+				int const on = 1;
+				setsockopt(listen_m, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+				if (::bind(listen_m, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0)
+					throw_errno("bind");
+				socklen_t length = sizeof(local);
+				getsockname(listen_m, reinterpret_cast<sockaddr*>(&local), &length);
+				fprintf(stderr, "ee22: serving on tcp:127.0.0.1:%u", unsigned(ntohs(local.sin_port)));
+			}
+			else {
+				sockaddr_un local{};
+				local.sun_family = AF_UNIX;
+				if (address.empty() || address.size() >= sizeof(local.sun_path))
+					throw invalid_argument("bad Unix socket path '" + address + "'");
+				memcpy(local.sun_path, address.c_str(), address.size() + 1);
+
+				// replace a socket left by an earlier server, but never another kind of file
+				struct stat status;
+				if (lstat(address.c_str(), &status) == 0 && S_ISSOCK(status.st_mode))
+					unlink(address.c_str());
+				listen_m = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+				if (listen_m < 0)
+					throw_errno("socket");
+				if (::bind(listen_m, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0)
+					throw_errno("bind");
+				unixPath_m = address;
+				fprintf(stderr, "ee22: serving on %s", address.c_str());
+			}
+			if (::listen(listen_m, SOMAXCONN) != 0)
+				throw_errno("listen");
+			_watch(listen_m, EPOLLIN);
+
+			wake_m = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (wake_m < 0)
+				throw_errno("eventfd");
+			_watch(wake_m, EPOLLIN);
+
+			// the signals are taken from the signalfd; blocked before the workers start, so they inherit the mask
+			sigset_t signals;
+			sigemptyset(&signals);
+			sigaddset(&signals, SIGINT);
+			sigaddset(&signals, SIGTERM);
+			pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+			signal_m = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+			if (signal_m < 0)
+				throw_errno("signalfd");
+			_watch(signal_m, EPOLLIN);
+		}
+
+		void _start() {
+			unsigned count = options_m.workers ? options_m.workers : max(thread::hardware_concurrency(), 1u);
+			fprintf(stderr, " with %u workers\n", count);
+			workerCount_m = count;
+			for (unsigned i = 0; i < count; ++i)
+				workers_m.emplace_back([this] { _work(); });
+		}
+
+		void _accept() {
+			for (;;) {
+				int fd = accept4(listen_m, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+				if (fd < 0) {
+					if (errno == EINTR || errno == ECONNABORTED)
+						continue;
+					return;		// EAGAIN, or out of descriptors: try again on the next event
+				}
+				if (unixPath_m.empty()) {
+					int const on = 1;
+					setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+				}
+				_watch(fd, EPOLLIN | EPOLLRDHUP);
+				auto session = make_shared<Session>(fd, chrono::milliseconds(options_m.deadlineMs));
+				session->evaluator.set_limits(options_m.limits);
+				sessions_m.emplace(fd, move(session));
+				++stats_m.connections;
+			}
+		}
+
+		/*! Reads what is available, splitting it into lines. */
+		void _read(Session& session) {
+			char buffer[read_size_c];
+			while (!session.eof) {
+				auto const count = ::read(session.fd, buffer, sizeof(buffer));
+				if (count > 0)
+					session.input.append(buffer, size_t(count));
+				else if (count == 0)
+					session.eof = true;
+				else if (errno == EINTR)
+					continue;
+				else if (errno == EAGAIN || errno == EWOULDBLOCK)
+					break;
+				else {
+					_close(session);
+					return;
+				}
+			}
+			if (session.eof)	// stop level-triggered wake ups for a half-closed socket
+				_watch(session.fd, _session_events(session), EPOLL_CTL_MOD);
+
+			auto const now = clock_type::now();
+			size_t first = 0;
+			for (size_t newline; (newline = session.input.find('\n', first)) != string::npos; first = newline + 1) {
+				size_t last = newline;
+				if (last > first && session.input[last - 1] == '\r')
+					--last;
+				_admit(session, string_view(session.input).substr(first, last - first), now);
+			}
+			session.input.erase(0, first);
+
+			if (session.eof && !session.input.empty()) {
+				_admit(session, session.input, now);
+				session.input.clear();
+			}
+			else if (session.input.size() > max_line_c) {
+				// answered in its place, after the lines before it
+				session.pending.push_back(Request{ "error: line too long", clock_type::time_point::max(), session.priority, false });
+				session.input.clear();
+				session.eof = true;
+				_watch(session.fd, _session_events(session), EPOLL_CTL_MOD);
+			}
+		}
+
+		/*! Queues a line, or answers it at once if it is a control line or is rejected. */
+		void _admit(Session& session, string_view line, clock_type::time_point now) {
+			if (line.find_first_not_of(" \t") == string_view::npos) {
+				session.pending.push_back(Request{ string(), clock_type::time_point::max(), session.priority, false });
+				return;
+			}
+			if (line[0] == '#') {
+				session.pending.push_back(Request{ _control(session, line), clock_type::time_point::max(), session.priority, false });
+				return;
+			}
+
+			auto const deadline = session.deadline.count() > 0 ? now + session.deadline : clock_type::time_point::max();
+			auto const level = size_t(session.priority);
+			AdmissionLoad load;
+			for (size_t i = 0; i <= level; ++i)
+				load.waiting += waiting_m[i].load(memory_order_relaxed);
+			load.classWaiting = waiting_m[level].load(memory_order_relaxed);
+			load.backlog = session.backlog;
+			load.lineSeconds = lineSeconds_m.load(memory_order_relaxed);
+			load.workers = workerCount_m;
+
+			char const* refusal = nullptr;
+			switch (admit(load, options_m.maxQueued, session.deadline)) {
+			case Admission::QueueFull:		refusal = "error: rejected, queue full"; break;
+			case Admission::DeadlineMissed:	refusal = "error: rejected, deadline can't be met"; break;
+			case Admission::Admitted:		break;
+			}
+			if (refusal) {
+				++stats_m.rejected;
+				session.pending.push_back(Request{ refusal, deadline, session.priority, false });
+				return;
+			}
+
+			++stats_m.queued;
+			++session.backlog;
+			waiting_m[level].fetch_add(1, memory_order_relaxed);
+			session.pending.push_back(Request{ string(line), deadline, session.priority, true });
+		}
+
+		/*! Applies a control line. @return its answer. */
+		string _control(Session& session, string_view line) {
+			if (line == "#priority high" || line == "#priority normal" || line == "#priority low") {
+				auto const name = line.substr(10);
+				session.priority = name == "high" ? Priority::High : name == "normal" ? Priority::Normal : Priority::Low;
+				return "ok";
+			}
+			if (line.rfind("#deadline ", 0) == 0) {
+				string const value(line.substr(10));
+				char* end = nullptr;
+				auto const ms = strtoul(value.c_str(), &end, 10);
+				if (end != value.c_str() && *end == '\0') {
+					session.deadline = chrono::milliseconds(ms);
+					return "ok";
+				}
+			}
+			if (line == "#stats")
+				return "queued " + to_string(stats_m.queued) + " rejected " + to_string(stats_m.rejected) + " expired " + to_string(stats_m.expired);
+			return "error: unknown control line";
+		}
+
+		/*! Hands the session's pending lines to a worker, unless it already has a batch.
+			Answers that need no evaluation at the front of the pending lines are sent at once.
+			*/
+		void _schedule(session_pointer const& session) {
+			if (session->busy || session->closed)
+				return;
+
+			size_t answered = 0;
+			for (; answered < session->pending.size() && !session->pending[answered].admitted; ++answered) {
+				session->output += session->pending[answered].text;
+				session->output += '\n';
+			}
+			if (answered > 0) {
+				stats_m.requests += answered;
+				session->pending.erase(session->pending.begin(), session->pending.begin() + ptrdiff_t(answered));
+				_flush(*session);
+				if (session->closed)
+					return;
+			}
+			if (session->pending.empty())
+				return;
+
+			if (session->pending.size() <= options_m.maxBatch) {
+				session->batch.clear();
+				swap(session->batch, session->pending);
+			}
+			else {
+				auto const split = session->pending.begin() + ptrdiff_t(options_m.maxBatch);
+				session->batch.assign(make_move_iterator(session->pending.begin()), make_move_iterator(split));
+				session->pending.erase(session->pending.begin(), split);
+			}
+			session->busy = true;
+			++stats_m.batches;
+			stats_m.requests += session->batch.size();
+			stats_m.batched += session->batch.size();
+			stats_m.largestBatch = max<uint64_t>(stats_m.largestBatch, session->batch.size());
+			{
+				lock_guard lock(mutex_m);
+				ready_m[size_t(session->priority)].push_back(session);
+				readySizes_m[size_t(session->priority)].fetch_add(1, memory_order_relaxed);
+			}
+			work_m.notify_one();
+		}
+
+		void _work() {
+			for (;;) {
+				session_pointer session;
+				{
+					unique_lock lock(mutex_m);
+					auto const has_work = [this] {
+						return any_of(ready_m.begin(), ready_m.end(), [](auto const& queue) { return !queue.empty(); });
+					};
+					work_m.wait(lock, [&] { return stopping_m || has_work(); });
+					if (stopping_m)
+						return;
+					auto const level = size_t(find_if(ready_m.begin(), ready_m.end(), [](auto const& queue) { return !queue.empty(); }) - ready_m.begin());
+					session = move(ready_m[level].front());
+					ready_m[level].pop_front();
+					readySizes_m[level].fetch_sub(1, memory_order_relaxed);
+				}
+
+				session->results.clear();
+				session->errors = 0;
+				session->expired = 0;
+				session->evaluated = 0;
+				size_t reached = 0;
+				for (; reached < session->batch.size(); ++reached) {
+					auto const& request = session->batch[reached];
+					// yield to a higher class between lines; the rest of the batch goes back to the session
+					if (reached > 0 && _higher_ready(request.priority))
+						break;
+					if (!request.admitted) {
+						session->results += request.text;
+						session->results += '\n';
+						continue;
+					}
+					waiting_m[size_t(request.priority)].fetch_sub(1, memory_order_relaxed);
+					++session->evaluated;
+					if (clock_type::now() > request.deadline) {
+						session->results += "error: expired\n";
+						++session->expired;
+						continue;
+					}
+					auto const start = clock_type::now();
+					auto const result = session->evaluator.try_evaluate(request.text);
+					_measure(clock_type::now() - start);
+					if (append_result(session->results, result ? *result : nullptr, result.error()))
+						++session->errors;
+				}
+				session->batch.erase(session->batch.begin(), session->batch.begin() + ptrdiff_t(reached));
+
+				{
+					lock_guard lock(mutex_m);
+					done_m.push_back(move(session));
+				}
+				uint64_t const one = 1;
+				(void)!::write(wake_m, &one, sizeof(one));
+			}
+		}
+
+		/*! Folds the time of one evaluation into the moving average; concurrent updates may lose a sample. */
+		void _measure(clock_type::duration elapsed) {
+			double const seconds = chrono::duration<double>(elapsed).count();
+			double const average = lineSeconds_m.load(memory_order_relaxed);
+			lineSeconds_m.store(average == 0.0 ? seconds : average + (seconds - average) / 8.0, memory_order_relaxed);
+		}
+
+		[[nodiscard]] bool _higher_ready(Priority priority) const {
+			for (size_t level = 0; level < size_t(priority); ++level)
+				if (readySizes_m[level].load(memory_order_relaxed) > 0)
+					return true;
+			return false;
+		}
+
+		/*! Sends the results of the finished batches and schedules the next ones; the lines a worker
+			yielded before reaching are put back in front of the session's pending lines.
+			*/
+		void _complete() {
+			uint64_t count;
+			(void)!::read(wake_m, &count, sizeof(count));
+			vector<session_pointer> done;
+			{
+				lock_guard lock(mutex_m);
+				swap(done, done_m);
+			}
+			for (auto& session : done) {
+				session->busy = false;
+				stats_m.errors += session->errors;
+				stats_m.expired += session->expired;
+				session->backlog -= session->evaluated;
+				stats_m.requests -= session->batch.size();
+				stats_m.batched -= session->batch.size();
+				session->pending.insert(session->pending.begin(), make_move_iterator(session->batch.begin()), make_move_iterator(session->batch.end()));
+				session->batch.clear();
+				if (session->closed) {
+					_forget_pending(*session);
+					continue;
+				}
+				session->output += session->results;
+				_flush(*session);
+				_schedule(session);
+				_close_if_finished(*session);
+			}
+		}
+
+		void _flush(Session& session) {
+			size_t sent = 0;
+			while (sent < session.output.size()) {
+				auto const count = send(session.fd, session.output.data() + sent, session.output.size() - sent, MSG_NOSIGNAL);
+				if (count >= 0)
+					sent += size_t(count);
+				else if (errno == EINTR)
+					continue;
+				else if (errno == EAGAIN || errno == EWOULDBLOCK)
+					break;
+				else {
+					_close(session);
+					return;
+				}
+			}
+			session.output.erase(0, sent);
+
+			bool const blocked = !session.output.empty();
+			if (blocked != session.writing) {
+				session.writing = blocked;
+				_watch(session.fd, _session_events(session), EPOLL_CTL_MOD);
+			}
+		}
+
+		void _close_if_finished(Session& session) {
+			if (!session.closed && session.eof && !session.busy && session.pending.empty() && session.output.empty())
+				_close(session);
+		}
+
+		/*! Drops the lines of a closed session that no worker has reached. */
+		void _forget_pending(Session& session) {
+			for (auto const& request : session.pending)
+				if (request.admitted)
+					waiting_m[size_t(request.priority)].fetch_sub(1, memory_order_relaxed);
+			session.pending.clear();
+		}
+
+		void _close(Session& session) {
+			if (session.closed)
+				return;
+			session.closed = true;
+			_forget_pending(session);
+			epoll_ctl(epoll_m, EPOLL_CTL_DEL, session.fd, nullptr);
+			::close(session.fd);
+			sessions_m.erase(session.fd);		// a busy session lives on in its worker until the batch is done
+		}
+
+		void _shutdown() {
+			{
+				lock_guard lock(mutex_m);
+				stopping_m = true;
+			}
+			work_m.notify_all();
+			for (auto& worker : workers_m)
+				worker.join();
+			workers_m.clear();
+
+			while (!sessions_m.empty())
+				_close(*sessions_m.begin()->second);
+			for (int* fd : { &listen_m, &wake_m, &signal_m, &epoll_m })
+				if (*fd >= 0) {
+					::close(*fd);
+					*fd = -1;
+				}
+			if (!unixPath_m.empty()) {
+				unlink(unixPath_m.c_str());
+				unixPath_m.clear();
+			}
+		}
+	};
+}
+
+
+
+[[nodiscard]] int serve_main(ServerOptions const& options) {
+	try {
+		Server server(options);
+		auto const stats = server.run();
+		fprintf(stderr, "%llu connections, %llu requests, %llu errors in %llu batches (mean %.1f, largest %llu lines)\n",
+			static_cast<unsigned long long>(stats.connections), static_cast<unsigned long long>(stats.requests),
+			static_cast<unsigned long long>(stats.errors), static_cast<unsigned long long>(stats.batches),
+			stats.mean_batch(), static_cast<unsigned long long>(stats.largestBatch));
+		fprintf(stderr, "%llu queued, %llu rejected, %llu expired\n",
+			static_cast<unsigned long long>(stats.queued), static_cast<unsigned long long>(stats.rejected),
+			static_cast<unsigned long long>(stats.expired));
+	}
+	catch (exception const& e) {
+		fprintf(stderr, "ee22: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+#else
+[[nodiscard]] int serve_main(ServerOptions const&) {
+	fprintf(stderr, "ee22: --serve is only available on Linux\n");
+	return EXIT_FAILURE;
+}
+#endif
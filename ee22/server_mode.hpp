@@ -0,0 +1,87 @@
+#pragma once
+/*!	\file	server_mode.hpp
+	\brief	ee22 server mode declarations.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Server mode of the ee22 application: evaluates newline-delimited
+expressions sent over a Unix domain socket or localhost TCP.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/RPNEvaluator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/*! Server mode settings. */
+struct ServerOptions {
+	std::string		address;				/// a Unix domain socket path, or "tcp:<port>" for localhost TCP (port 0: any free port).
+	unsigned		workers = 0;			/// evaluation threads; 0 for one per hardware thread.
+	std::size_t		maxBatch = 1024;		/// lines evaluated in one batch, at most.
+	std::size_t		maxQueued = 10'000;		/// lines waiting in each priority class, at most; more are rejected.
+	unsigned		deadlineMs = 0;			/// default time allowed from a line's arrival to its evaluation; 0 for none.
+	EvaluationLimits	limits;				/// per line; a line that exceeds them is answered with its limit error.
+};
+
+
+/*! Scheduling class of a session; a worker takes the highest class that has work. */
+enum class Priority : unsigned char { High, Normal, Low };
+constexpr std::size_t priority_count_c = 3;
+
+
+/*! Server counters, reported when the server stops. */
+struct ServerStatistics {
+	std::uint64_t	connections = 0;
+	std::uint64_t	requests = 0;			/// lines received, including blank and control lines.
+	std::uint64_t	errors = 0;
+	std::uint64_t	batches = 0;
+	std::uint64_t	batched = 0;			/// lines handed to a worker in a batch.
+	std::uint64_t	largestBatch = 0;
+	std::uint64_t	queued = 0;				/// lines admitted for evaluation.
+	std::uint64_t	rejected = 0;			/// lines refused on arrival: their class was full, or they could not meet their deadline.
+	std::uint64_t	expired = 0;			/// admitted lines whose deadline passed before a worker reached them.
+
+	[[nodiscard]] double mean_batch() const { return batches ? double(batched) / double(batches) : 0.0; }
+};
+
+
+/*!	Runs the evaluation server until SIGINT or SIGTERM (Linux only).
+
+	Each connection is a session with its own variables.  Every line a client sends is evaluated
+	in order and answered with one line, formatted as in batch mode.  The lines that arrive
+	together are coalesced into one batch, evaluated by a worker thread in one go, and their
+	results are sent back together.  Sessions are evaluated in parallel, a session's batches
+	one after another.
+
+	Admission control: a session starts in the Normal class with the server's default deadline, and
+	changes them with the control lines "#priority high|normal|low" and "#deadline <ms>" (0: none);
+	"#stats" answers with the counters.  A line is rejected on arrival ("error: rejected, ...") if its
+	class already has 'maxQueued' lines waiting, or if its predicted wait exceeds its deadline: the
+	lines waiting in its class and above shared by the workers, or its session's own backlog evaluated
+	one after another, whichever is longer, at the recent evaluation time per line (see admit()).
+	An admitted line whose deadline has passed when a worker reaches it is answered "error: expired".
+	@return the process exit code.
+	*/
+[[nodiscard]] int serve_main(ServerOptions const& options);
@@ -0,0 +1,520 @@
+/*!	\file	shm_mode.cpp
+	\brief	ee22 shared-memory mode implementation.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+
+#include "shm_mode.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+#if defined(__linux__)
+	#include <ee/boolean.hpp>
+	#include <ee/integer.hpp>
+	#include <ee/real.hpp>
+	#include <ee/rule_set.hpp>
+	#include <ee/RPNEvaluator.hpp>
+	#include <ee/variable.hpp>
+	#include <algorithm>
+	#include <cerrno>
+	#include <chrono>
+	#include <cstring>
+	#include <fstream>
+	#include <new>
+	#include <system_error>
+	#include <thread>
+	#include <vector>
+
+	#include <fcntl.h>
+	#include <linux/futex.h>
+	#include <signal.h>
+	#include <sys/mman.h>
+	#include <sys/socket.h>
+	#include <sys/stat.h>
+	#include <sys/syscall.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+using namespace std;
+
+
+
+#if defined(__linux__)
+namespace {
+	constexpr unsigned spin_limit_c = 64;			/// polls before yielding.
+	constexpr unsigned yield_limit_c = 256;			/// polls before sleeping on a futex.
+	constexpr long sleep_timeout_ns_c = 100'000'000;	/// futex sleeps wake to check for shutdown.
+
+	/*! Waits while a shared futex word holds 'expected', for at most the sleep timeout.  Not FUTEX_PRIVATE: the word may be in another process. */
+	void futex_wait(atomic<uint32_t>& word, uint32_t expected) {
+		timespec const timeout{ 0, sleep_timeout_ns_c };
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+	}
+
+	void futex_wake(atomic<uint32_t>& word, int count) {
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, count, nullptr, nullptr, 0);
+	}
+
+	/*! Spins, then yields; returns false once it is time to sleep instead.
+		Spinning only pays if the other party runs on another core at the same time.
+		*/
+	[[nodiscard]] bool backoff(unsigned& polls) {
+		static unsigned const spinLimit = thread::hardware_concurrency() > 1 ? spin_limit_c : 0;
+		if (++polls < spinLimit)
+			return true;
+		if (polls < yield_limit_c) {
+			this_thread::yield();
+			return true;
+		}
+		return false;
+	}
+
+	/*! Shared memory object names start with a slash. */
+	[[nodiscard]] string object_name(string const& name) {
+		return !name.empty() && name[0] == '/' ? name : "/" + name;
+	}
+
+	[[nodiscard]] double to_double(Operand::pointer_type value) {
+		if (is<Variable>(value))
+			value = convert<Variable>(value)->value();
+		if (is<Real>(value))
+			return value_of<Real>(value).convert_to<double>();
+		if (is<Integer>(value))
+			return value_of<Integer>(value).convert_to<double>();
+		if (is<Boolean>(value))
+			return value_of<Boolean>(value) ? 1.0 : 0.0;
+		return 0.0;
+	}
+
+
+
+	/*! A rule and the variables that its parameters are bound to, in order of first use. */
+	struct Program {
+		TokenList				postfix;
+		vector<Token const*>	params;
+		bool					valid = false;
+	};
+
+	[[nodiscard]] Program make_program(CompiledRule const& rule) {
+		Program program;
+		program.postfix = rule.postfix();
+		for (auto const& token : program.postfix)
+			if (is<Variable>(token) && find(program.params.begin(), program.params.end(), token.get()) == program.params.end())
+				program.params.push_back(token.get());
+		program.valid = !rule.error() && program.params.size() <= shm_max_params_c;
+		return program;
+	}
+
+
+
+	class ShmServer {
+		string				name_m;
+		ShmRegion*			region_m = nullptr;
+		vector<Program>		programs_m;
+		atomic<bool>		stopping_m{ false };
+		vector<thread>		workers_m;
+
+	public:
+		ShmServer(string const& name, RuleSet const& rules) : name_m(object_name(name)) {
+			for (auto const& rule : rules.rules())
+				programs_m.push_back(make_program(rule));
+
+			// never initialize over a region in use: its server and clients would be corrupted
+			int fd = shm_open(name_m.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+			if (fd < 0) {
+				auto error = errno;
+				throw system_error(error, generic_category(), "shm_open " + name_m + (error == EEXIST ? " (in use, or left by a server that crashed)" : ""));
+			}
+			if (ftruncate(fd, sizeof(ShmRegion)) != 0) {
+				auto error = errno;
+				::close(fd);
+				shm_unlink(name_m.c_str());
+				throw system_error(error, generic_category(), "ftruncate " + name_m);
+			}
+			void* memory = mmap(nullptr, sizeof(ShmRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			auto error = errno;
+			::close(fd);
+			if (memory == MAP_FAILED) {
+				shm_unlink(name_m.c_str());
+				throw system_error(error, generic_category(), "mmap " + name_m);
+			}
+
+			region_m = new (memory) ShmRegion;
+			region_m->magic = shm_magic_c;
+			region_m->version = shm_version_c;
+			region_m->expressionCount = uint32_t(programs_m.size());
+			for (uint32_t i = 0; i < shm_slot_count_c; ++i) {
+				region_m->slots[i].state.store(uint32_t(ShmSlotState::Free), memory_order_relaxed);
+				(void)region_m->freeSlots.try_push(i);
+			}
+			region_m->ready.store(1, memory_order_release);
+		}
+
+		~ShmServer() {
+			stop();
+			region_m->ready.store(0, memory_order_release);
+			munmap(region_m, sizeof(ShmRegion));
+			shm_unlink(name_m.c_str());
+		}
+
+		void start(unsigned count) {
+			for (unsigned i = 0; i < count; ++i)
+				workers_m.emplace_back([this] { _work(); });
+		}
+
+		void stop() {
+			stopping_m = true;
+			region_m->doorbell.fetch_add(1);
+			futex_wake(region_m->doorbell, INT32_MAX);
+			for (auto& worker : workers_m)
+				worker.join();
+			workers_m.clear();
+		}
+
+	private:
+		/*! Gets the next request, sleeping on the doorbell when there is none.  Returns false on shutdown. */
+		[[nodiscard]] bool _next(uint32_t& index) {
+			for (unsigned polls = 0; !stopping_m; ) {
+				if (region_m->requests.try_pop(index))
+					return true;
+				if (backoff(polls))
+					continue;
+
+				// announce the sleep before the last look, so a client that pushes after it rings
+				region_m->sleepers.fetch_add(1);
+				auto const seen = region_m->doorbell.load();
+				bool const found = region_m->requests.try_pop(index);
+				if (!found)
+					futex_wait(region_m->doorbell, seen);
+				region_m->sleepers.fetch_sub(1);
+				if (found)
+					return true;
+				polls = 0;
+			}
+			return false;
+		}
+
+		void _work() {
+			RPNEvaluator rpn;
+			TokenList bound;
+			for (uint32_t index; _next(index); ) {
+				auto& slot = region_m->slots[index];
+				slot.status = ShmStatus::Ok;
+				slot.error = 0;
+				slot.result = 0.0;
+				if (slot.expression >= programs_m.size() || !programs_m[slot.expression].valid)
+					slot.status = ShmStatus::BadExpression;
+				else if (slot.paramCount != programs_m[slot.expression].params.size())
+					slot.status = ShmStatus::BadParameters;
+				else {
+					auto const& program = programs_m[slot.expression];
+					bound.clear();
+					for (auto const& token : program.postfix) {
+						if (!is<Variable>(token)) {
+							bound.push_back(token);
+							continue;
+						}
+						auto const param = size_t(find(program.params.begin(), program.params.end(), token.get()) - program.params.begin());
+						bound.push_back(make_operand<Real>(Real::value_type(slot.params[param])));
+					}
+					auto const result = rpn.try_evaluate(bound);
+					if (result)
+						slot.result = to_double(*result);
+					else {
+						slot.status = ShmStatus::Failed;
+						slot.error = uint8_t(result.error().code);
+					}
+				}
+
+				if (slot.state.exchange(uint32_t(ShmSlotState::Done), memory_order_acq_rel) == uint32_t(ShmSlotState::Waiting))
+					futex_wake(slot.state, 1);
+			}
+		}
+	};
+
+
+
+	/*! Percentiles of round-trip times, in microseconds. */
+	struct Latency {
+		double	p50 = 0.0;
+		double	p99 = 0.0;
+		double	mean = 0.0;
+	};
+
+	[[nodiscard]] Latency summarize(vector<double>& microseconds) {
+		Latency latency;
+		if (microseconds.empty())
+			return latency;
+		sort(microseconds.begin(), microseconds.end());
+		latency.p50 = microseconds[microseconds.size() / 2];
+		latency.p99 = microseconds[min(microseconds.size() - 1, microseconds.size() * 99 / 100)];
+		for (auto us : microseconds)
+			latency.mean += us;
+		latency.mean /= double(microseconds.size());
+		return latency;
+	}
+
+
+
+	/*! A blocking line-at-a-time client of the server mode. */
+	class SocketClient {
+		int		fd_m;
+		string	input_m;
+	public:
+		explicit SocketClient(string const& path) {
+			sockaddr_un address{};
+			address.sun_family = AF_UNIX;
+			if (path.size() >= sizeof(address.sun_path))
+				throw invalid_argument("bad Unix socket path '" + path + "'");
+			memcpy(address.sun_path, path.c_str(), path.size() + 1);
+			fd_m = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+			if (fd_m < 0 || connect(fd_m, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+				throw system_error(errno, generic_category(), "connect " + path);
+		}
+		~SocketClient() { ::close(fd_m); }
+
+		[[nodiscard]] string request(string const& line) {
+			string const message = line + "\n";
+			for (size_t sent = 0; sent < message.size(); ) {
+				auto const count = send(fd_m, message.data() + sent, message.size() - sent, MSG_NOSIGNAL);
+				if (count < 0)
+					throw system_error(errno, generic_category(), "send");
+				sent += size_t(count);
+			}
+			for (size_t newline; ; ) {
+				if ((newline = input_m.find('\n')) != string::npos) {
+					string reply = input_m.substr(0, newline);
+					input_m.erase(0, newline + 1);
+					return reply;
+				}
+				char buffer[4096];
+				auto const count = recv(fd_m, buffer, sizeof(buffer), 0);
+				if (count <= 0)
+					throw runtime_error("the server closed the connection");
+				input_m.append(buffer, size_t(count));
+			}
+		}
+	};
+}
+
+
+
+ShmClient::ShmClient(string const& name) {
+	auto const object = object_name(name);
+	int fd = shm_open(object.c_str(), O_RDWR | O_CLOEXEC, 0);
+	if (fd < 0)
+		throw system_error(errno, generic_category(), "shm_open " + object);
+	struct stat status;
+	if (fstat(fd, &status) != 0 || size_t(status.st_size) < sizeof(ShmRegion)) {
+		::close(fd);
+		throw runtime_error(object + " is not an ee22 shared-memory region");
+	}
+	void* memory = mmap(nullptr, sizeof(ShmRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	auto error = errno;
+	::close(fd);
+	if (memory == MAP_FAILED)
+		throw system_error(error, generic_category(), "mmap " + object);
+
+	region_m = static_cast<ShmRegion*>(memory);
+	if (region_m->magic != shm_magic_c || region_m->version != shm_version_c || !region_m->ready.load(memory_order_acquire)) {
+		munmap(region_m, sizeof(ShmRegion));
+		throw runtime_error(object + " has no running ee22 server");
+	}
+}
+
+
+
+ShmClient::~ShmClient() {
+	munmap(region_m, sizeof(ShmRegion));
+}
+
+
+
+/*!	Evaluates a rule with the given parameter values.
+	Throws std::invalid_argument if there are too many parameters, std::runtime_error if the server stops.
+	*/
+[[nodiscard]] ShmClient::Reply ShmClient::evaluate(uint32_t expression, span<double const> params) {
+	if (params.size() > shm_max_params_c)
+		throw invalid_argument("ShmClient::evaluate: too many parameters");
+	auto check_server = [this] {
+		if (!region_m->ready.load(memory_order_acquire))
+			throw runtime_error("the ee22 shared-memory server stopped");
+	};
+
+	uint32_t index;
+	for (unsigned polls = 0; !region_m->freeSlots.try_pop(index); )
+		if (!backoff(polls)) {
+			check_server();
+			this_thread::sleep_for(chrono::microseconds(50));
+		}
+
+	auto& slot = region_m->slots[index];
+	slot.expression = expression;
+	slot.paramCount = uint32_t(params.size());
+	copy(params.begin(), params.end(), slot.params);
+	slot.state.store(uint32_t(ShmSlotState::Pending), memory_order_relaxed);
+	while (!region_m->requests.try_push(index))		// can't stay full: there are only as many slots as cells
+		this_thread::yield();
+	region_m->doorbell.fetch_add(1);
+	if (region_m->sleepers.load() > 0)
+		futex_wake(region_m->doorbell, 1);
+
+	for (unsigned polls = 0; slot.state.load(memory_order_acquire) != uint32_t(ShmSlotState::Done); ) {
+		if (backoff(polls))
+			continue;
+		auto expected = uint32_t(ShmSlotState::Pending);
+		if (slot.state.compare_exchange_strong(expected, uint32_t(ShmSlotState::Waiting)) || expected == uint32_t(ShmSlotState::Waiting))
+			futex_wait(slot.state, uint32_t(ShmSlotState::Waiting));
+		check_server();
+	}
+
+	Reply reply{ slot.status, slot.error, slot.result };
+	slot.state.store(uint32_t(ShmSlotState::Free), memory_order_relaxed);
+	(void)region_m->freeSlots.try_push(index);
+	return reply;
+}
+
+
+
+[[nodiscard]] int shm_serve_main(string const& name, string const& rulesPath, unsigned workers) {
+	try {
+		// the signals are taken with sigwait(); blocked before the workers start, so they inherit the mask
+		sigset_t signals;
+		sigemptyset(&signals);
+		sigaddset(&signals, SIGINT);
+		sigaddset(&signals, SIGTERM);
+		pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+		auto const rules = RuleSet::load(rulesPath);
+		ShmServer server(name, rules);
+		if (workers == 0)
+			workers = max(thread::hardware_concurrency(), 1u);
+		server.start(workers);
+		fprintf(stderr, "ee22: serving %zu rules on shared memory %s with %u workers\n",
+			rules.rules().size(), object_name(name).c_str(), workers);
+
+		int signal = 0;
+		sigwait(&signals, &signal);
+		server.stop();
+	}
+	catch (exception const& e) {
+		fprintf(stderr, "ee22: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+
+
+[[nodiscard]] int shm_bench_main(string const& name, string const& socketPath, string const& rulesPath, size_t iterations) {
+	try {
+		// the first valid rule, its source line, and its variables in order of first use
+		auto const rules = RuleSet::load(rulesPath, 1);
+		auto const rule = find_if(rules.rules().begin(), rules.rules().end(), [](CompiledRule const& r) { return !r.error(); });
+		if (rule == rules.rules().end())
+			throw runtime_error("no valid rule in " + rulesPath);
+		auto const program = make_program(*rule);
+		if (!program.valid)
+			throw runtime_error("the first rule has more than " + to_string(shm_max_params_c) + " variables");
+
+		string source;
+		ifstream file(rulesPath);
+		for (size_t line = 0; line <= rule->line(); ++line)
+			getline(file, source);
+		if (!source.empty() && source.back() == '\r')
+			source.pop_back();
+
+		vector<double> params;
+		for (size_t i = 0; i < program.params.size(); ++i)
+			params.push_back(1.5 + double(i));
+
+		using clock_type = chrono::steady_clock;
+		auto time = [&](auto roundTrip) {
+			for (size_t i = 0; i < iterations / 10 + 1; ++i)		// warm up
+				roundTrip();
+			vector<double> microseconds;
+			microseconds.reserve(iterations);
+			for (size_t i = 0; i < iterations; ++i) {
+				auto const start = clock_type::now();
+				roundTrip();
+				microseconds.push_back(chrono::duration<double, micro>(clock_type::now() - start).count());
+			}
+			return summarize(microseconds);
+		};
+
+		ShmClient shm(name);
+		auto const expression = uint32_t(rule - rules.rules().begin());
+		auto const shmReply = shm.evaluate(expression, params);
+		if (shmReply.status != ShmStatus::Ok)
+			throw runtime_error("the shared-memory server failed the rule (status " + to_string(int(shmReply.status)) + ")");
+		auto const shmLatency = time([&] { (void)shm.evaluate(expression, params); });
+		auto const shmTransport = time([&] { (void)shm.evaluate(shm.expression_count(), {}); });	// rejected unevaluated
+
+		// the socket session gets the parameters as variables first, then sends the rule text
+		SocketClient socket(socketPath);
+		for (size_t i = 0; i < program.params.size(); ++i)
+			(void)socket.request(static_cast<Variable const*>(program.params[i])->name() + " = " + to_string(params[i]));
+		auto const socketReply = socket.request(source);
+		auto const socketLatency = time([&] { (void)socket.request(source); });
+		auto const socketTransport = time([&] { (void)socket.request(""); });		// answered unevaluated
+
+		auto report = [](char const* what, Latency const& latency) {
+			fprintf(stderr, "  %-28s p50 %8.2f us, p99 %8.2f us, mean %8.2f us\n", what, latency.p50, latency.p99, latency.mean);
+		};
+		fprintf(stderr, "rule \"%s\" with %zu parameters, %zu round trips each\n", source.c_str(), params.size(), iterations);
+		report("shared memory, rule:", shmLatency);
+		report("unix socket, rule:", socketLatency);
+		report("shared memory, round trip:", shmTransport);
+		report("unix socket, round trip:", socketTransport);
+		fprintf(stderr, "  results: %.17g / %s; round trip p50 ratio socket / shared memory: %.2f\n", shmReply.value, socketReply.c_str(),
+			shmTransport.p50 > 0.0 ? socketTransport.p50 / shmTransport.p50 : 0.0);
+	}
+	catch (exception const& e) {
+		fprintf(stderr, "ee22: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+#else
+ShmClient::ShmClient(string const&) {
+	throw runtime_error("ee22 shared-memory mode is only available on Linux");
+}
+
+ShmClient::~ShmClient() = default;
+
+[[nodiscard]] ShmClient::Reply ShmClient::evaluate(uint32_t, span<double const>) {
+	return Reply{};
+}
+
+[[nodiscard]] int shm_serve_main(string const&, string const&, unsigned) {
+	fprintf(stderr, "ee22: --shm-serve is only available on Linux\n");
+	return EXIT_FAILURE;
+}
+
+[[nodiscard]] int shm_bench_main(string const&, string const&, string const&, size_t) {
+	fprintf(stderr, "ee22: --shm-bench is only available on Linux\n");
+	return EXIT_FAILURE;
+}
+#endif
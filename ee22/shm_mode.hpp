@@ -0,0 +1,142 @@
+#pragma once
+/*!	\file	shm_mode.hpp
+	\brief	ee22 shared-memory mode declarations.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Shared-memory mode of the ee22 application: co-located clients
+submit compiled rules and their parameters through lock-free
+rings in a memory-mapped region.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.17
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/mpmc_ring.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+
+/*! Limits of the shared region. */
+constexpr std::uint32_t		shm_magic_c = 0x32324545;		/// "EE22"
+constexpr std::uint32_t		shm_version_c = 1;
+constexpr std::size_t		shm_slot_count_c = 1024;
+constexpr std::size_t		shm_max_params_c = 8;
+
+
+/*! What a slot holds; a slot goes Free -> Pending (-> Waiting) -> Done -> Free. */
+enum class ShmSlotState : std::uint32_t {
+	Free,
+	Pending,		/// submitted.
+	Waiting,		/// submitted, and the client sleeps on the state until it changes.
+	Done			/// the result is in the slot.
+};
+
+
+/*! The outcome of a request. */
+enum class ShmStatus : std::uint8_t {
+	Ok,
+	BadExpression,		/// no rule with that id, or it failed to compile.
+	BadParameters,		/// the parameter count isn't the rule's variable count.
+	Failed				/// evaluation failed; 'error' has the ErrorCode.
+};
+
+
+/*! One request and, written back in place, its result. */
+struct alignas(64) ShmSlot {
+	std::atomic<std::uint32_t>	state;				/// ShmSlotState; also the futex word the client sleeps on.
+	std::uint32_t				expression;			/// rule index in the server's rule file.
+	std::uint32_t				paramCount;
+	ShmStatus					status;
+	std::uint8_t				error;				/// ErrorCode, when status is Failed.
+	double						params[shm_max_params_c];	/// the values of the rule's variables, in order of first use.
+	double						result;
+};
+
+
+/*!	The shared region.  The server creates and initializes it, then sets 'ready'.
+
+	A client takes a slot index from 'freeSlots', fills the slot in, pushes the index on 'requests'
+	and rings the doorbell; a server worker pops it, evaluates, writes the result into the slot
+	and marks it Done.  The doorbell and the slot states are futex words, so an idle server and a
+	client waiting for a slow result sleep instead of spinning.
+	*/
+struct ShmRegion {
+	std::uint32_t				magic;
+	std::uint32_t				version;
+	std::atomic<std::uint32_t>	ready;				/// 0 until initialized, and again once the server stops.
+	std::uint32_t				expressionCount;
+
+	alignas(64) std::atomic<std::uint32_t>	doorbell;	/// bumped after each request is pushed.
+	std::atomic<std::uint32_t>				sleepers;	/// server workers sleeping on the doorbell.
+
+	MpmcRing<std::uint32_t, shm_slot_count_c>	freeSlots;
+	MpmcRing<std::uint32_t, shm_slot_count_c>	requests;
+	ShmSlot										slots[shm_slot_count_c];
+};
+
+
+/*! A client of a shared-memory server, for one thread; several clients may share a region. */
+class ShmClient {
+	// Block copying
+	ShmClient(ShmClient const&) = delete;
+	ShmClient& operator = (ShmClient const&) = delete;
+
+// TYPES
+public:
+	struct Reply {
+		ShmStatus		status = ShmStatus::Ok;
+		std::uint8_t	error = 0;
+		double			value = 0.0;
+	};
+
+// ATTRIBUTES
+private:
+	ShmRegion*	region_m = nullptr;
+
+// OPERATIONS
+public:
+	/*! Maps the region of a running server.  Throws std::system_error if there is none. */
+	explicit ShmClient(std::string const& name);
+	~ShmClient();
+
+	/*! Evaluates a rule with the given parameter values; waits for a free slot and for the result. */
+	[[nodiscard]] Reply evaluate(std::uint32_t expression, std::span<double const> params);
+
+	[[nodiscard]] std::uint32_t expression_count() const { return region_m->expressionCount; }
+};
+
+
+/*!	Runs the shared-memory server on the rules of a rule file until SIGINT or SIGTERM (Linux only).
+	@param name [in] the shared memory object name, e.g. "/ee22"; the server fails if it already exists.
+	@return the process exit code.
+	*/
+[[nodiscard]] int shm_serve_main(std::string const& name, std::string const& rulesPath, unsigned workers);
+
+/*!	Compares the round-trip latency of the first rule of a rule file through a shared-memory server
+	and through a server mode Unix socket, both already running; and the bare round trip of each,
+	without evaluation.  The socket request is tokenized and parsed each time; the shared-memory one is compiled.
+	@return the process exit code.
+	*/
+[[nodiscard]] int shm_bench_main(std::string const& name, std::string const& socketPath, std::string const& rulesPath, std::size_t iterations);
@@ -19,11 +19,23 @@ TestApp frame declarations.
 	GATS_CHECK_WITHIN()
 	GATS_CHECK_THROW()
 	GATS_FAIL()
+	TestApp::Benchmark class declaration.
+	GATS_BENCHMARK()
+	gats::do_not_optimize()
 
 =============================================================
 Revision History
 -------------------------------------------------------------
 
+2026-10-17
+	Added: Benchmarks
+		TestApp::Benchmark
+		GATS_BENCHMARK()
+		gats::do_not_optimize()
+		command-line: --no-benchmarks, --benchmark-samples n, --benchmark-time ms, --benchmark-warmup ms
+	Added: JSON report and benchmark regression gating
+		command-line: --json file, --baseline file, --threshold percent, --compare old new
+
 2022-11-06
 	Changed: macro local variable names to guard against name masking.
 
@@ -68,6 +80,7 @@ the program(s) have been supplied.
 
 #include <gats/ConsoleApp.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
@@ -150,6 +163,69 @@ namespace gats {
 			friend class TestApp;
 		};
 
+
+		/*!	\brief class TestApp::Benchmark
+
+			Benchmark is the base type of classes generated by GATS_BENCHMARK().
+			execute() is one iteration of the measured operation.  The runner warms it up, calibrates
+			the number of iterations so that each sample lasts about the sample time, then times
+			several samples and reports their statistics in time per iteration. */
+		class Benchmark {
+		// TYPES
+		public:
+			struct Settings {
+				std::chrono::nanoseconds	warmup{ std::chrono::milliseconds(50) };		// time spent running before measuring.
+				std::chrono::nanoseconds	sampleTime{ std::chrono::milliseconds(10) };	// target duration of one sample.
+				unsigned					samples = 20;
+			};
+
+			/*! Nanoseconds per iteration, over the samples. */
+			struct Statistics {
+				double	mean = 0.0;
+				double	median = 0.0;
+				double	stddev = 0.0;
+				double	p99 = 0.0;
+				double	min = 0.0;
+				double	max = 0.0;
+			};
+
+		// ATTRIBUTES
+		private:
+			string_type			name_m;
+			string_type			group_m;
+
+			std::uintmax_t		iterations_m = 0;		// iterations per sample.
+			std::vector<double>	samples_m;				// nanoseconds per iteration of each sample.
+
+		// OPERATIONS
+		public:
+			// Blocked
+			Benchmark(Benchmark const&) = delete;
+			void operator = (Benchmark const&) = delete;
+
+			// Constructors
+			Benchmark(string_type const& name, string_type const& group);
+			Benchmark(string_type const& name) : Benchmark(name, string_type{}) {}
+
+			// Application Interface
+			virtual void execute() = 0;
+
+			// Runner
+			void run(Settings const& settings);
+			[[nodiscard]] Statistics statistics() const;
+			[[nodiscard]] std::uintmax_t iterations() const { return iterations_m; }
+			[[nodiscard]] std::vector<double> const& samples() const { return samples_m; }
+
+			constexpr auto operator <=> (Benchmark const& rhs) const { return name_m <=> rhs.name_m; }
+			constexpr bool operator == (Benchmark const& rhs) const { return name_m == rhs.name_m; }
+
+		private:
+			[[nodiscard]] std::chrono::nanoseconds _time(std::uintmax_t iterations);
+
+			// Access
+			friend class TestApp;
+		};
+
 	// ATTRIBUTES
 	private:
 		using case_pointer_type = TestCase*;								/// will point to statically allocated test cases.
@@ -157,13 +233,39 @@ namespace gats {
 		using case_groups_type	= std::map<string_type, case_list_type>;
 		using case_groups_pointer_type = std::unique_ptr<case_groups_type>;
 
+		using benchmark_pointer_type		= Benchmark*;				/// will point to statically allocated benchmarks.
+		using benchmark_list_type			= std::vector<benchmark_pointer_type>;
+		using benchmark_groups_type			= std::map<string_type, benchmark_list_type>;
+		using benchmark_groups_pointer_type	= std::unique_ptr<benchmark_groups_type>;
+
 		static case_groups_pointer_type	casesPtr_sm;
 		static ofstream_type			logFile_m;
 		static case_pointer_type		currentCasePtr_sm;
 
+		static benchmark_groups_pointer_type	benchmarksPtr_sm;
+
+		bool					runBenchmarks_m = true;
+		Benchmark::Settings		benchmarkSettings_m;
+
+		using benchmark_medians_type = std::map<string_type, double>;	/// "group/name" -> median nanoseconds per iteration.
+
+		std::filesystem::path	jsonPath_m;						/// --json: where to write the machine-readable report.
+		std::filesystem::path	baselinePath_m;					/// --baseline: report to compare this run's benchmarks against.
+		std::filesystem::path	comparePaths_m[2];				/// --compare: two reports to compare, without running anything.
+		double					regressionThreshold_m = 10.0;	/// percentage slowdown of a median that fails the comparison.
+
 	// OPERATIONS
 		static ostream_type&		display() { return std::cout; }
 		static case_groups_type&	cases();
+		static benchmark_groups_type&	benchmarks();
+
+		void run_benchmarks();
+
+		// Reports
+		static void write_json(std::filesystem::path const& path);
+		[[nodiscard]] static benchmark_medians_type read_benchmark_medians(std::filesystem::path const& path);
+		[[nodiscard]] static benchmark_medians_type benchmark_medians();
+		[[nodiscard]] bool compare_benchmarks(benchmark_medians_type const& baseline, benchmark_medians_type const& current) const;
 
 		// Interface
 		void setup() override;
@@ -174,6 +276,26 @@ namespace gats {
 	};
 
 
+	namespace detail {
+		extern void const volatile* volatile benchmarkSink_g;
+	}
+
+
+	/*!	\brief Keeps a benchmark's result from being optimized away.
+
+		The compiler must assume that 'value' is read, so the work that produced it can't be removed.
+	*/
+	template <typename T>
+	inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		detail::benchmarkSink_g = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+	}
+
+
 	/*!	\brief Check for value equality.
 	
 		Check for value equality, reporting if different.
@@ -259,6 +381,22 @@ namespace gats {
 	void TestCase_ ## MACRO_PARAM_GTCP_name :: execute()
 
 
+/*!	Creates a benchmark with the identifier 'name'
+
+	\param 'name' is the benchmark's identifier.
+	\param optional group name.
+
+	The body is one iteration of the measured operation; pass its result to gats::do_not_optimize().
+	Benchmarks run after the test cases, and don't count towards the score.  GATS_CHECK macros can't be used in a benchmark.
+*/
+#define GATS_BENCHMARK(MACRO_PARAM_GB_name, ...) \
+	static class Benchmark_ ## MACRO_PARAM_GB_name : public gats::TestApp::Benchmark {\
+	public: Benchmark_ ## MACRO_PARAM_GB_name() : Benchmark(#MACRO_PARAM_GB_name __VA_OPT__(,) __VA_ARGS__) { }\
+	public: virtual void execute() override;\
+	} Benchmark_ ## MACRO_PARAM_GB_name ## _g;\
+	void Benchmark_ ## MACRO_PARAM_GB_name :: execute()
+
+
 /*!	Performs a check point for the specified condition.
 
 	\param 'cond' is condition that must pass.
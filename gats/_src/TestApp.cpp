@@ -22,6 +22,12 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+2026-10-17
+	Added:
+		TestApp::Benchmark
+		benchmark command-line options
+		report command-line options
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,6 +63,8 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -116,6 +124,93 @@ namespace gats {
 
 
 
+// ----------------------------------------------------------------------------
+// TestApp::Benchmark
+// ----------------------------------------------------------------------------
+
+	void const volatile* volatile detail::benchmarkSink_g = nullptr;
+
+
+
+	/*!	Benchmark constructor registers the benchmark with the TestApp */
+	TestApp::Benchmark::Benchmark(string_type const& name, string_type const& group) : name_m(name), group_m(group) {
+		auto& benchmarks = TestApp::benchmarks();
+		benchmarks[group_m].push_back(this);
+	}
+
+
+
+	/*!	Times 'iterations' calls of execute(). */
+	std::chrono::nanoseconds TestApp::Benchmark::_time(std::uintmax_t iterations) {
+		using namespace std::chrono;
+		auto start = high_resolution_clock::now();
+		for (std::uintmax_t i = 0; i < iterations; ++i)
+			execute();
+		return duration_cast<nanoseconds>(high_resolution_clock::now() - start);
+	}
+
+
+
+	/*!	Warms up, calibrates the iterations per sample, then records the samples. */
+	void TestApp::Benchmark::run(Settings const& settings) {
+		using namespace std::chrono;
+		samples_m.clear();
+
+		// warm-up: caches, branch predictors, lazy initialization, clock frequency
+		auto start = high_resolution_clock::now();
+		do
+			execute();
+		while (high_resolution_clock::now() - start < settings.warmup);
+
+		// calibrate: grow the iteration count until a run is long enough to scale from
+		auto const target = std::max<nanoseconds::rep>(settings.sampleTime.count(), 1);
+		std::uintmax_t iterations = 1;
+		for (;;) {
+			auto const elapsed = std::max<nanoseconds::rep>(_time(iterations).count(), 1);
+			if (elapsed * 2 >= target) {
+				iterations = std::max<std::uintmax_t>(1, std::uintmax_t(double(iterations) * target / elapsed));
+				break;
+			}
+			iterations *= elapsed * 10 < target ? 10 : 2;
+		}
+		iterations_m = iterations;
+
+		// measure
+		for (unsigned sample = 0; sample < std::max(settings.samples, 1u); ++sample)
+			samples_m.push_back(double(_time(iterations_m).count()) / double(iterations_m));
+	}
+
+
+
+	/*!	Gets the statistics of the samples, in nanoseconds per iteration. */
+	TestApp::Benchmark::Statistics TestApp::Benchmark::statistics() const {
+		Statistics stats;
+		if (samples_m.empty())
+			return stats;
+
+		auto sorted = samples_m;
+		std::sort(sorted.begin(), sorted.end());
+		auto const n = sorted.size();
+
+		double sum = 0.0;
+		for (auto sample : sorted)
+			sum += sample;
+		stats.mean = sum / double(n);
+
+		double squares = 0.0;
+		for (auto sample : sorted)
+			squares += (sample - stats.mean) * (sample - stats.mean);
+		stats.stddev = n > 1 ? std::sqrt(squares / double(n - 1)) : 0.0;
+
+		stats.median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+		stats.p99 = sorted[std::min(n - 1, std::size_t(std::ceil(0.99 * double(n))) - 1)];		// nearest rank
+		stats.min = sorted.front();
+		stats.max = sorted.back();
+		return stats;
+	}
+
+
+
 // ----------------------------------------------------------------------------
 // TestApp
 // ----------------------------------------------------------------------------
@@ -124,6 +219,7 @@ namespace gats {
 	TestApp::case_groups_pointer_type	TestApp::casesPtr_sm;
 	TestApp::ofstream_type				TestApp::logFile_m;
 	TestApp::case_pointer_type			TestApp::currentCasePtr_sm = nullptr;
+	TestApp::benchmark_groups_pointer_type	TestApp::benchmarksPtr_sm;
 	TestApp::string_type const			TestApp::TestCase::defaultGroup_csm{};
 
 
@@ -141,6 +237,15 @@ namespace gats {
 
 
 
+	/*!	Returns a reference to the benchmarks container. */
+	TestApp::benchmark_groups_type& TestApp::benchmarks() {
+		if (!benchmarksPtr_sm)
+			benchmarksPtr_sm.reset(new benchmark_groups_type);
+		return *benchmarksPtr_sm;
+	}
+
+
+
 	/*!	Get a reference to the cases container. */
 	TestApp::case_pointer_type TestApp::current_case(const char* file, int line) {
 		using namespace std;
@@ -151,9 +256,47 @@ namespace gats {
 	}
 
 
-	/*!	'setup' overrides the application method to register a logfile for storing test results. */
+	/*!	'setup' overrides the application method to register a logfile for storing test results.
+		Reads the benchmark options:
+			--no-benchmarks				skip the benchmarks.
+			--benchmark-samples n		samples per benchmark.
+			--benchmark-time ms			duration of one sample.
+			--benchmark-warmup ms		time spent running a benchmark before measuring it.
+		and the report options:
+			--json file					write every case and benchmark to 'file' as JSON.
+			--baseline file				fail if a benchmark is slower than in the JSON report 'file'.
+			--threshold percent			slowdown of a benchmark's median that counts as a regression (default 10).
+			--compare old new			compare the benchmarks of two JSON reports; runs nothing.
+	*/
 	void TestApp::setup() {
 		using namespace std;
+		auto const& args = get_args();
+		for (size_t i = 1; i < args.size(); ++i) {
+			auto next = [&]() -> string_type const& {
+				if (i + 1 >= args.size())
+					throw std::runtime_error("Missing value after: "s + args[i]);
+				return args[++i];
+			};
+			if (args[i] == "--no-benchmarks")
+				runBenchmarks_m = false;
+			else if (args[i] == "--benchmark-samples")
+				benchmarkSettings_m.samples = unsigned(stoul(next()));
+			else if (args[i] == "--benchmark-time")
+				benchmarkSettings_m.sampleTime = chrono::milliseconds(stoul(next()));
+			else if (args[i] == "--benchmark-warmup")
+				benchmarkSettings_m.warmup = chrono::milliseconds(stoul(next()));
+			else if (args[i] == "--json")
+				jsonPath_m = next();
+			else if (args[i] == "--baseline")
+				baselinePath_m = next();
+			else if (args[i] == "--threshold")
+				regressionThreshold_m = stod(next());
+			else if (args[i] == "--compare") {
+				comparePaths_m[0] = next();
+				comparePaths_m[1] = next();
+			}
+		}
+
 		std::filesystem::path filename = "gats-test-log-file.txt";
 		logFile_m.open(filename);
 		if (!logFile_m) {
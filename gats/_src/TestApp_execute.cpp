@@ -22,6 +22,10 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+2026-10-17
+	Added: benchmark report
+	Added: JSON report, --baseline and --compare
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,8 +61,10 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <iomanip>
 using namespace std;
 using namespace std::chrono;
 #if defined(_WIN32)
@@ -78,9 +84,68 @@ using namespace gats::win32;
 
 
 namespace gats {
+	namespace {
+		/*!	Formats nanoseconds in the largest unit that keeps the value at least 1. */
+		string format_time(double ns) {
+			char const* unit = "ns";
+			if (ns >= 1'000) { ns /= 1'000; unit = "us"; }
+			if (ns >= 1'000) { ns /= 1'000; unit = "ms"; }
+			if (ns >= 1'000) { ns /= 1'000; unit = "s "; }
+			ostringstream oss;
+			oss << setw(7) << setprecision(ns < 100 ? 2 : 1) << fixed << ns << ' ' << unit;
+			return oss.str();
+		}
+	}
+
+
+
+	/*!	Runs every benchmark and reports its time per iteration. */
+	void TestApp::run_benchmarks() {
+		for (auto& benchmarkGroup : benchmarks()) {
+			auto& group = benchmarkGroup.second;
+			sort(begin(group), end(group), [](benchmark_pointer_type pLHS, benchmark_pointer_type pRHS) { return *pLHS < *pRHS; });
+		}
+
+		for (auto& benchmarkGroup : benchmarks()) {
+			cout << (bright(white) + background(blue));
+			cout << "Benchmarks: " << (benchmarkGroup.first.empty() ? "(ungrouped)" : benchmarkGroup.first);
+			cout << white << '\n';
+
+			for (auto& benchmark : benchmarkGroup.second) {
+				try {
+					benchmark->run(benchmarkSettings_m);
+				}
+				catch (std::exception const& e) {
+					cout << bright(red) << benchmark->name_m << ": " << e.what() << white << endl;
+					continue;
+				}
+				catch (...) {
+					cout << bright(red) << benchmark->name_m << ": Unknown exception caught." << white << endl;
+					continue;
+				}
+
+				auto const stats = benchmark->statistics();
+				cout << "mean" << format_time(stats.mean);
+				cout << "  median" << format_time(stats.median);
+				cout << "  sd" << format_time(stats.stddev);
+				cout << "  p99" << format_time(stats.p99);
+				cout << "  (" << benchmark->samples_m.size() << " x " << benchmark->iterations_m << ")";
+				cout << cyan;
+				cout << " " << benchmark->name_m;
+				cout << white << endl;
+			}
+		}
+	}
+
+
+
 	/*!	'execute' overrides the application interface method to perform all test cases and log/report the results. */
 	int TestApp::execute() {
 
+		// compare two earlier reports, running nothing
+		if (!comparePaths_m[0].empty())
+			return compare_benchmarks(read_benchmark_medians(comparePaths_m[0]), read_benchmark_medians(comparePaths_m[1])) ? EXIT_SUCCESS : EXIT_FAILURE;
+
 		// pass/fail color code function
 		auto setcolor = [=](auto passed, auto checked) {
 			if (checked == 0)
@@ -237,6 +302,12 @@ namespace gats {
 
 
 
+		// run the benchmarks
+		if (runBenchmarks_m)
+			run_benchmarks();
+
+
+
 		// report summary
 		double checkPercentage{ 100.0 * nChecksPassed / nChecked_m };
 
@@ -269,6 +340,16 @@ namespace gats {
 		std::cout << oss.str() << std::endl;
 		logFile_m << oss.str() << std::endl;
 
+		cout << white;
+
+
+
+		// machine-readable report and regression gate
+		if (!jsonPath_m.empty())
+			write_json(jsonPath_m);
+		if (!baselinePath_m.empty() && !compare_benchmarks(read_benchmark_medians(baselinePath_m), benchmark_medians()))
+			return EXIT_FAILURE;
+
 		return EXIT_SUCCESS;
 	}
 
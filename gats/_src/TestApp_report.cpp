@@ -0,0 +1,364 @@
+/*!	\file	TestApp_report.cpp
+	\brief	TestApp JSON report and benchmark comparison.
+	\author	Garth Santor
+	\date	2026-10-17
+	\copyright	Garth Santor, Trinh Han
+
+=========================================================================
+TestApp report implementations.
+	TestApp::write_json()
+	TestApp::read_benchmark_medians()
+	TestApp::benchmark_medians()
+	TestApp::compare_benchmarks()
+
+=========================================================================
+Revision History
+-------------------------------------------------------------
+
+2026-10-17
+	Alpha release.
+
+=========================================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=========================================================================*/
+
+
+#include <gats/TestApp.hpp>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+using namespace std;
+
+
+
+namespace gats {
+	namespace {
+		/*!	Writes 'text' as a JSON string. */
+		void write_string(ostream& os, string const& text) {
+			os << '"';
+			for (unsigned char c : text) {
+				switch (c) {
+				case '"':	os << "\\\"";	break;
+				case '\\':	os << "\\\\";	break;
+				case '\n':	os << "\\n";	break;
+				case '\r':	os << "\\r";	break;
+				case '\t':	os << "\\t";	break;
+				default:
+					if (c < 0x20)
+						os << "\\u" << hex << setw(4) << setfill('0') << int(c) << dec << setfill(' ');
+					else
+						os << c;
+				}
+			}
+			os << '"';
+		}
+
+
+
+		/*!	The key of a benchmark in a comparison. */
+		string benchmark_key(string const& group, string const& name) {
+			return group.empty() ? name : group + "/" + name;
+		}
+
+
+
+		/*!	JsonValue is a parsed JSON value; enough of JSON to read back a report. */
+		struct JsonValue {
+			enum class Kind { Null, Boolean, Number, String, Array, Object };
+			Kind				kind = Kind::Null;
+			bool				boolean = false;
+			double				number = 0.0;
+			string				text;
+			vector<string>		keys;		// object member names, parallel to 'items'.
+			vector<JsonValue>	items;		// array elements or object member values.
+
+			/*! Gets the member 'key' of an object, or nullptr. */
+			JsonValue const* find(string const& key) const {
+				for (size_t i = 0; i < keys.size(); ++i)
+					if (keys[i] == key)
+						return &items[i];
+				return nullptr;
+			}
+		};
+
+
+
+		/*!	JsonReader is a recursive-descent JSON parser.  Throws std::runtime_error on malformed input. */
+		class JsonReader {
+			string const&	text_m;
+			size_t			pos_m = 0;
+
+		public:
+			explicit JsonReader(string const& text) : text_m(text) { }
+
+			JsonValue parse() {
+				auto value = _value();
+				_skip_space();
+				if (pos_m != text_m.size())
+					_fail("unexpected text after the value");
+				return value;
+			}
+
+		private:
+			[[noreturn]] void _fail(char const* what) const {
+				throw runtime_error("JSON error at offset "s + to_string(pos_m) + ": " + what);
+			}
+
+			void _skip_space() {
+				while (pos_m < text_m.size() && isspace((unsigned char)text_m[pos_m]))
+					++pos_m;
+			}
+
+			bool _accept(char c) {
+				_skip_space();
+				if (pos_m < text_m.size() && text_m[pos_m] == c) {
+					++pos_m;
+					return true;
+				}
+				return false;
+			}
+
+			void _expect(char c) {
+				if (!_accept(c))
+					_fail("unexpected character");
+			}
+
+			bool _accept_word(char const* word) {
+				string_view const w(word);
+				if (text_m.compare(pos_m, w.size(), w) != 0)
+					return false;
+				pos_m += w.size();
+				return true;
+			}
+
+			JsonValue _value() {
+				_skip_space();
+				if (pos_m >= text_m.size())
+					_fail("unexpected end of text");
+
+				JsonValue value;
+				char const c = text_m[pos_m];
+				if (c == '{') {
+					value.kind = JsonValue::Kind::Object;
+					++pos_m;
+					if (!_accept('}')) {
+						do {
+							_skip_space();
+							value.keys.push_back(_string());
+							_expect(':');
+							value.items.push_back(_value());
+						} while (_accept(','));
+						_expect('}');
+					}
+				}
+				else if (c == '[') {
+					value.kind = JsonValue::Kind::Array;
+					++pos_m;
+					if (!_accept(']')) {
+						do
+							value.items.push_back(_value());
+						while (_accept(','));
+						_expect(']');
+					}
+				}
+				else if (c == '"') {
+					value.kind = JsonValue::Kind::String;
+					value.text = _string();
+				}
+				else if (_accept_word("true") || _accept_word("false")) {
+					value.kind = JsonValue::Kind::Boolean;
+					value.boolean = c == 't';
+				}
+				else if (_accept_word("null"))
+					value.kind = JsonValue::Kind::Null;
+				else {
+					char const* begin = text_m.c_str() + pos_m;
+					char* end = nullptr;
+					value.kind = JsonValue::Kind::Number;
+					value.number = strtod(begin, &end);
+					if (end == begin)
+						_fail("expected a value");
+					pos_m += size_t(end - begin);
+				}
+				return value;
+			}
+
+			string _string() {
+				if (pos_m >= text_m.size() || text_m[pos_m] != '"')
+					_fail("expected a string");
+				++pos_m;
+				string result;
+				while (pos_m < text_m.size() && text_m[pos_m] != '"') {
+					char c = text_m[pos_m++];
+					if (c == '\\') {
+						if (pos_m >= text_m.size())
+							break;
+						c = text_m[pos_m++];
+						switch (c) {
+						case 'n':	c = '\n';	break;
+						case 'r':	c = '\r';	break;
+						case 't':	c = '\t';	break;
+						case 'b':	c = '\b';	break;
+						case 'f':	c = '\f';	break;
+						case 'u':
+							if (pos_m + 4 > text_m.size())
+								_fail("bad escape");
+							c = char(stoi(text_m.substr(pos_m, 4), nullptr, 16));		// reports only escape control characters
+							pos_m += 4;
+							break;
+						}
+					}
+					result += c;
+				}
+				if (pos_m >= text_m.size())
+					_fail("unterminated string");
+				++pos_m;
+				return result;
+			}
+		};
+	}
+
+
+
+	/*!	Writes every case and every measured benchmark to 'path' as JSON.
+		Times are in nanoseconds; a benchmark's samples are its time per iteration.
+	*/
+	void TestApp::write_json(std::filesystem::path const& path) {
+		ofstream os(path);
+		if (!os)
+			throw runtime_error("Could not open: "s + path.string());
+		os << setprecision(17);
+
+		os << "{\n\t\"cases\": [";
+		char const* separator = "\n";
+		for (auto const& testCaseGroup : cases()) {
+			for (auto const& testCase : testCaseGroup.second) {
+				os << separator << "\t\t{ \"group\": ";
+				write_string(os, testCase->group_m);
+				os << ", \"name\": ";
+				write_string(os, testCase->name_m);
+				os << ", \"checked\": " << testCase->nChecked_m;
+				os << ", \"passed\": " << testCase->nPassed_m;
+				os << ", \"weight\": " << testCase->weight_m;
+				os << ", \"elapsed_ns\": " << testCase->elapsedTime_m.count() << " }";
+				separator = ",\n";
+			}
+		}
+		os << "\n\t],\n\t\"benchmarks\": [";
+
+		separator = "\n";
+		for (auto const& benchmarkGroup : benchmarks()) {
+			for (auto const& benchmark : benchmarkGroup.second) {
+				if (benchmark->samples_m.empty())
+					continue;
+				auto const stats = benchmark->statistics();
+				os << separator << "\t\t{ \"group\": ";
+				write_string(os, benchmark->group_m);
+				os << ", \"name\": ";
+				write_string(os, benchmark->name_m);
+				os << ", \"iterations\": " << benchmark->iterations_m;
+				os << ", \"mean_ns\": " << stats.mean;
+				os << ", \"median_ns\": " << stats.median;
+				os << ", \"stddev_ns\": " << stats.stddev;
+				os << ", \"p99_ns\": " << stats.p99;
+				os << ", \"min_ns\": " << stats.min;
+				os << ", \"max_ns\": " << stats.max;
+				os << ",\n\t\t  \"samples_ns\": [";
+				for (size_t i = 0; i < benchmark->samples_m.size(); ++i)
+					os << (i ? ", " : " ") << benchmark->samples_m[i];
+				os << " ] }";
+				separator = ",\n";
+			}
+		}
+		os << "\n\t]\n}\n";
+
+		if (!os)
+			throw runtime_error("Could not write: "s + path.string());
+	}
+
+
+
+	/*!	Reads the benchmark medians of a JSON report written by write_json(). */
+	TestApp::benchmark_medians_type TestApp::read_benchmark_medians(std::filesystem::path const& path) {
+		ifstream is(path);
+		if (!is)
+			throw runtime_error("Could not open: "s + path.string());
+		ostringstream text;
+		text << is.rdbuf();
+
+		auto const report = JsonReader(text.str()).parse();
+		auto const list = report.find("benchmarks");
+		if (report.kind != JsonValue::Kind::Object || !list || list->kind != JsonValue::Kind::Array)
+			throw runtime_error("Not a benchmark report: "s + path.string());
+
+		benchmark_medians_type medians;
+		for (auto const& benchmark : list->items) {
+			auto const group = benchmark.find("group");
+			auto const name = benchmark.find("name");
+			auto const median = benchmark.find("median_ns");
+			if (!name || !median || median->kind != JsonValue::Kind::Number)
+				throw runtime_error("Malformed benchmark in: "s + path.string());
+			medians[benchmark_key(group ? group->text : string{}, name->text)] = median->number;
+		}
+		return medians;
+	}
+
+
+
+	/*!	Gets the medians of the benchmarks measured in this run. */
+	TestApp::benchmark_medians_type TestApp::benchmark_medians() {
+		benchmark_medians_type medians;
+		for (auto const& benchmarkGroup : benchmarks())
+			for (auto const& benchmark : benchmarkGroup.second)
+				if (!benchmark->samples_m.empty())
+					medians[benchmark_key(benchmark->group_m, benchmark->name_m)] = benchmark->statistics().median;
+		return medians;
+	}
+
+
+
+	/*!	Reports the change in the median of each benchmark.
+		\return false if any benchmark is slower than its baseline by more than the regression threshold.
+		Benchmarks that are in only one of the runs are listed but don't fail the comparison.
+	*/
+	bool TestApp::compare_benchmarks(benchmark_medians_type const& baseline, benchmark_medians_type const& current) const {
+		size_t regressions = 0;
+		cout << "\nBenchmark comparison (median, threshold " << setprecision(1) << fixed << regressionThreshold_m << "%)\n";
+		for (auto const& [key, median] : current) {
+			auto const old = baseline.find(key);
+			if (old == baseline.end()) {
+				cout << "  new       " << key << '\n';
+				continue;
+			}
+			double const change = old->second > 0.0 ? (median - old->second) * 100.0 / old->second : 0.0;
+			bool const regressed = change > regressionThreshold_m;
+			regressions += regressed;
+			cout << (regressed ? "  REGRESSED " : "  ok        ");
+			cout << setw(7) << showpos << change << noshowpos << "%  ";
+			cout << setprecision(1) << old->second << " ns -> " << median << " ns  " << key << '\n';
+		}
+		for (auto const& [key, median] : baseline)
+			if (current.find(key) == current.end())
+				cout << "  missing   " << key << '\n';
+
+		cout << regressions << " regression" << (regressions == 1 ? "" : "s") << endl;
+		return regressions == 0;
+	}
+
+} // end-of-namespace gats